@@ -0,0 +1,132 @@
+/**
+ * @file AllocationBenchmark.cpp
+ * @brief Counts the heap allocations of repeated solves
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Usage: bench_allocations [REPEATS]
+ *
+ * Replaces the global operator new with a counting one, solves each case
+ * twice to size its vectors and workspace, then counts the allocations of
+ * REPEATS further setParameters + solve cycles. Every case must reach
+ * zero; the exit status is 1 if one does not.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <atomic>
+#include <new>
+#include <cstdlib>
+
+#include "Ensemble.h"
+#include "StepObserver.h"
+#include "Utility.h"
+
+namespace {
+
+std::atomic<long> allocations(0);
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    allocations++;
+    void* p = std::malloc(size != 0 ? size : 1);
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+// Warm up, then return the allocations per cycle
+double countPerCycle(int repeats, const std::function<void()>& cycle) {
+    cycle();
+    cycle();
+    long before = allocations.load();
+    for (int i = 0; i < repeats; ++i) {
+        cycle();
+    }
+    return static_cast<double>(allocations.load() - before) / repeats;
+}
+
+bool report(const std::string& name, double perCycle) {
+    std::cout << std::left << std::setw(50) << name << std::right << std::setw(12)
+              << std::fixed << std::setprecision(2) << perCycle << std::endl;
+    return perCycle == 0.0;
+}
+
+// Harmonic oscillator with a damped third component
+void oscillator(double, const double* y, double* dydx) {
+    dydx[0] = y[1];
+    dydx[1] = -y[0];
+    dydx[2] = -0.5 * y[2];
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int repeats = (argc > 1) ? std::atoi(argv[1]) : 100;
+    if (repeats < 1) {
+        repeats = 1;
+    }
+    bool ok = true;
+
+    std::cout << std::left << std::setw(50) << "Case" << std::right << std::setw(12)
+              << "Allocs/solve" << std::endl;
+    std::cout << std::string(62, '-') << std::endl;
+
+    std::vector<std::string> names = Utility::getMethodNames();
+    for (size_t m = 0; m < names.size(); ++m) {
+        std::unique_ptr<NumericalMethod> method(Utility::createMethod(names[m]));
+        method->setVerbose(false);
+        ok &= report(names[m] + " (stored)", countPerCycle(repeats, [&method]() {
+            method->setParameters(0.0, 1.0, 1.0, 0.01);
+            method->solve();
+        }));
+
+        // Streamed to an observer instead
+        std::unique_ptr<NumericalMethod> streamed(Utility::createMethod(names[m]));
+        streamed->setVerbose(false);
+        streamed->setObserver(std::make_shared<FinalValueObserver>());
+        ok &= report(names[m] + " (final value only)", countPerCycle(repeats, [&streamed]() {
+            streamed->setParameters(0.0, 1.0, 1.0, 0.01);
+            streamed->solve();
+        }));
+    }
+
+    // Systems; these methods have no system solver
+    std::vector<double> y0(3, 1.0);
+    for (size_t m = 0; m < names.size(); ++m) {
+        if (names[m] == "dormand-prince" || names[m] == "adaptive-adams" || names[m] == "taylor") {
+            continue;
+        }
+        std::unique_ptr<NumericalMethod> method(Utility::createMethod(names[m]));
+        method->setVerbose(false);
+        method->setSystemFunction(oscillator);
+        ok &= report(names[m] + " (system of 3)", countPerCycle(repeats, [&method, &y0]() {
+            method->setParameters(0.0, y0, 1.0, 0.01);
+            method->solveSystem();
+        }));
+    }
+
+    // Ensemble of 1000 members
+    std::vector<double> x0s(1000, 0.0), y0s(1000, 1.0);
+    EnsembleSolver ensemble(EnsembleSolver::Scheme::RungeKutta4);
+    ok &= report("ensemble rk4 (1000 members)", countPerCycle(repeats, [&]() {
+        ensemble.setParameters(x0s, y0s, 1.0, 0.01);
+        ensemble.solve();
+    }));
+
+    std::cout << (ok ? "\nAll steady-state solves are allocation-free"
+                     : "\nSome steady-state solves allocate") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,235 @@
+/**
+ * @file BenchHarness.h
+ * @brief Warm-up, repetition statistics and JSON export for the benchmarks
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+/**
+ * @struct BenchResult
+ * @brief Timing statistics of one benchmark, in seconds per repetition
+ */
+struct BenchResult {
+    std::string name;
+    int repetitions;
+    double items;       // Steps (or rows) processed per repetition
+    double rhsCalls;    // Differential-function calls per repetition, 0 if none
+    double min;
+    double median;
+    double mean;
+    double stddev;
+};
+
+/**
+ * @class BenchHarness
+ * @brief Runs benchmarks with warm-up and repetitions and reports their statistics
+ *
+ * Every repetition first runs an untimed setup, then times the body alone,
+ * so allocation of fresh solvers does not count against solve().
+ */
+class BenchHarness {
+public:
+    /**
+     * @brief Constructor
+     * @param warmupCount Untimed runs before measuring
+     * @param repetitionCount Timed runs
+     * @param filterText Only run benchmarks whose name contains this text
+     */
+    BenchHarness(int warmupCount, int repetitionCount, const std::string& filterText = "")
+        : warmup(warmupCount), repetitions(std::max(1, repetitionCount)), filter(filterText) {}
+
+    /**
+     * @brief Run one benchmark
+     * @param name Unique name, used to match results between builds
+     * @param items Steps (or rows) processed by one run of the body
+     * @param rhsCalls Differential-function calls made by one run of the body
+     * @param setup Untimed preparation before each run
+     * @param body Timed code
+     */
+    void run(const std::string& name, double items, double rhsCalls,
+             std::function<void()> setup, std::function<void()> body) {
+        if (!filter.empty() && name.find(filter) == std::string::npos) {
+            return;
+        }
+
+        for (int i = 0; i < warmup; ++i) {
+            setup();
+            body();
+        }
+
+        std::vector<double> samples;
+        for (int i = 0; i < repetitions; ++i) {
+            setup();
+            auto start = std::chrono::steady_clock::now();
+            body();
+            samples.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+
+        BenchResult result;
+        result.name = name;
+        result.repetitions = repetitions;
+        result.items = items;
+        result.rhsCalls = rhsCalls;
+
+        std::sort(samples.begin(), samples.end());
+        size_t n = samples.size();
+        result.min = samples.front();
+        result.median = (n % 2 == 1) ? samples[n / 2] : 0.5 * (samples[n / 2 - 1] + samples[n / 2]);
+        result.mean = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            result.mean += samples[i];
+        }
+        result.mean /= n;
+        result.stddev = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            result.stddev += (samples[i] - result.mean) * (samples[i] - result.mean);
+        }
+        result.stddev = (n > 1) ? std::sqrt(result.stddev / (n - 1)) : 0.0;
+
+        printResult(result);
+        results.push_back(result);
+    }
+
+    /**
+     * @brief Print the table header
+     */
+    static void printHeader() {
+        std::cout << std::left << std::setw(40) << "Benchmark"
+                  << std::setw(14) << "Median (ms)"
+                  << std::setw(12) << "+/- (%)"
+                  << std::setw(16) << "Steps/sec"
+                  << std::setw(12) << "ns/RHS" << std::endl;
+        std::cout << std::string(94, '-') << std::endl;
+    }
+
+    /**
+     * @brief Get the results so far
+     */
+    const std::vector<BenchResult>& getResults() const {
+        return results;
+    }
+
+    /**
+     * @brief Save the results to a JSON file
+     * @param filename Name of the file to save to
+     */
+    void saveToJSON(const std::string& filename) const {
+        std::FILE* file = std::fopen(filename.c_str(), "w");
+        if (file == NULL) {
+            throw std::runtime_error("Failed to open file: " + filename);
+        }
+
+        std::fprintf(file, "{\n  \"warmup\": %d,\n  \"repetitions\": %d,\n  \"benchmarks\": [\n",
+                     warmup, repetitions);
+        for (size_t i = 0; i < results.size(); ++i) {
+            const BenchResult& r = results[i];
+            std::fprintf(file, "    {\"name\": \"%s\", \"items\": %.17g, \"rhsCalls\": %.17g, "
+                         "\"min\": %.9g, \"median\": %.9g, \"mean\": %.9g, \"stddev\": %.9g, "
+                         "\"stepsPerSecond\": %.9g, \"nsPerRhsCall\": %.9g}%s\n",
+                         r.name.c_str(), r.items, r.rhsCalls, r.min, r.median, r.mean, r.stddev,
+                         r.items / r.median, (r.rhsCalls > 0.0) ? r.median * 1e9 / r.rhsCalls : 0.0,
+                         (i + 1 < results.size()) ? "," : "");
+        }
+        std::fprintf(file, "  ]\n}\n");
+
+        if (std::fclose(file) != 0) {
+            throw std::runtime_error("Failed to write file: " + filename);
+        }
+    }
+
+    /**
+     * @brief Read the median of every benchmark from a file written by saveToJSON
+     * @param filename Name of the file to read
+     * @return Median seconds by benchmark name
+     */
+    static std::map<std::string, double> loadMedians(const std::string& filename) {
+        std::ifstream file(filename);
+        if (!file) {
+            throw std::runtime_error("Failed to open file: " + filename);
+        }
+
+        // One benchmark per line, as written by saveToJSON
+        std::map<std::string, double> medians;
+        std::string line;
+        while (std::getline(file, line)) {
+            size_t name = line.find("\"name\": \"");
+            size_t median = line.find("\"median\": ");
+            if (name == std::string::npos || median == std::string::npos) {
+                continue;
+            }
+            name += 9;
+            medians[line.substr(name, line.find('"', name) - name)] =
+                std::atof(line.c_str() + median + 10);
+        }
+        return medians;
+    }
+
+    /**
+     * @brief Print the change of every median against an earlier run
+     * @param baseline Medians returned by loadMedians
+     */
+    void printComparison(const std::map<std::string, double>& baseline) const {
+        std::cout << "\n" << std::left << std::setw(40) << "Benchmark"
+                  << std::setw(16) << "Baseline (ms)"
+                  << std::setw(16) << "Current (ms)"
+                  << std::setw(10) << "Change" << std::endl;
+        std::cout << std::string(82, '-') << std::endl;
+
+        for (size_t i = 0; i < results.size(); ++i) {
+            std::map<std::string, double>::const_iterator it = baseline.find(results[i].name);
+            if (it == baseline.end()) {
+                continue;
+            }
+            double change = (results[i].median / it->second - 1.0) * 100.0;
+            std::ostringstream changeText;
+            changeText << std::showpos << std::fixed << std::setprecision(1) << change << "%";
+
+            std::cout << std::left << std::setw(40) << results[i].name
+                      << std::fixed << std::setprecision(4)
+                      << std::setw(16) << it->second * 1e3
+                      << std::setw(16) << results[i].median * 1e3
+                      << std::setw(10) << changeText.str() << std::endl;
+        }
+    }
+
+private:
+    int warmup;
+    int repetitions;
+    std::string filter;
+    std::vector<BenchResult> results;
+
+    static void printResult(const BenchResult& r) {
+        double spread = (r.median > 0.0) ? r.stddev / r.median * 100.0 : 0.0;
+        std::cout << std::left << std::setw(40) << r.name
+                  << std::fixed << std::setprecision(4) << std::setw(14) << r.median * 1e3
+                  << std::setprecision(1) << std::setw(12) << spread
+                  << std::scientific << std::setprecision(3) << std::setw(16) << r.items / r.median;
+        if (r.rhsCalls > 0.0) {
+            std::cout << std::fixed << std::setprecision(2) << r.median * 1e9 / r.rhsCalls;
+        }
+        else {
+            std::cout << "-";
+        }
+        std::cout << std::endl;
+    }
+};
+
+#endif // BENCH_HARNESS_H
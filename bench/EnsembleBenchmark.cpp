@@ -0,0 +1,115 @@
+/**
+ * @file EnsembleBenchmark.cpp
+ * @brief Time per member and step of the ensemble solver with each kernel set
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Usage: bench_ensemble [MEMBERS] [STEPS]
+ *
+ * Integrates MEMBERS initial conditions (default 65536) of dy/dx = x + y
+ * over STEPS steps (default 100) with every scheme and every kernel set
+ * this CPU supports, and reports nanoseconds per member and step. The
+ * last row solves each member with its own RungeKutta4 object through
+ * solveSystem, the path the ensemble replaces. Times are the fastest of
+ * several solves.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <functional>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "Ensemble.h"
+#include "RungeKutta4.h"
+
+namespace {
+
+const int REPEATS = 5;
+const double INTERVAL = 1.0;
+
+// Fastest of REPEATS runs of solve, in nanoseconds
+double bestTime(const std::function<void()>& solve) {
+    double best = INFINITY;
+    for (int r = 0; r < REPEATS; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        solve();
+        best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    long members = (argc > 1) ? std::atol(argv[1]) : 65536;
+    int steps = (argc > 2) ? std::atoi(argv[2]) : 100;
+    if (members < 1 || steps < 1) {
+        std::cerr << "Usage: bench_ensemble [MEMBERS] [STEPS]" << std::endl;
+        return 2;
+    }
+
+    std::vector<double> x0s(members), y0s(members);
+    for (long i = 0; i < members; ++i) {
+        x0s[i] = 0.0;
+        y0s[i] = 1.0 + 1e-6 * i;
+    }
+    const double h = INTERVAL / steps;
+    const double work = static_cast<double>(members) * steps;
+
+    std::cout << "Ensemble of " << members << " members, " << steps << " steps" << std::endl;
+    std::cout << "Kernel set selected for this CPU: " << EnsembleSolver::getKernelName() << "\n\n";
+    std::cout << std::left << std::setw(44) << "Scheme" << std::setw(10) << "Kernel" << std::right
+              << std::setw(18) << "ns/member/step" << std::setw(12) << "Speedup" << "\n";
+    std::cout << std::string(84, '-') << "\n";
+
+    const EnsembleSolver::Scheme schemes[] = {
+        EnsembleSolver::Scheme::Euler,
+        EnsembleSolver::Scheme::ModifiedEuler,
+        EnsembleSolver::Scheme::RungeKutta2,
+        EnsembleSolver::Scheme::RungeKutta4
+    };
+    std::vector<std::string> kernels = EnsembleSolver::getAvailableKernels();
+
+    for (size_t s = 0; s < sizeof(schemes) / sizeof(schemes[0]); ++s) {
+        EnsembleSolver ensemble(schemes[s]);
+
+        // Scalar is the last kernel set; it is the reference of the speedup
+        std::vector<double> times(kernels.size());
+        for (size_t k = kernels.size(); k-- > 0;) {
+            ensemble.setKernel(kernels[k]);
+            times[k] = bestTime([&]() {
+                ensemble.setParameters(x0s, y0s, INTERVAL, h);
+                ensemble.solve();
+            }) / work;
+        }
+        for (size_t k = 0; k < kernels.size(); ++k) {
+            std::cout << std::left << std::setw(44) << ensemble.getMethodName() << std::setw(10)
+                      << kernels[k] << std::right << std::fixed << std::setprecision(3)
+                      << std::setw(18) << times[k] << std::setw(11) << std::setprecision(2)
+                      << times.back() / times[k] << "x\n";
+        }
+    }
+
+    // One RungeKutta4 per member, in full precision like the ensemble
+    RungeKutta4 rk4;
+    rk4.setVerbose(false);
+    rk4.setSystemFunction([](double x, const double* y, double* dydx) { dydx[0] = x + y[0]; });
+    std::vector<double> y0(1);
+    double perMember = bestTime([&]() {
+        for (long i = 0; i < members; ++i) {
+            y0[0] = y0s[i];
+            rk4.setParameters(x0s[i], y0, INTERVAL, h);
+            rk4.solveSystem();
+        }
+    }) / work;
+    std::cout << std::left << std::setw(44) << "4th Order Runge-Kutta Method (per member)"
+              << std::setw(10) << "-" << std::right << std::fixed << std::setprecision(3)
+              << std::setw(18) << perMember << "\n";
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file ExpressionBenchmark.cpp
+ * @brief Compares compiled Expressions with the same functions written in C++
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Usage: bench_expression [POINTS]
+ *
+ * Evaluates a few right-hand sides at POINTS points (default 1000000), once
+ * as a lambda, once through Expression one point at a time and once through
+ * the batch form of Expression, and prints the time per point and the
+ * slowdown against the lambda. The last table solves y' = f(x, y) with RK4
+ * through the std::function of each.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "Expression.h"
+#include "RungeKutta4.h"
+
+namespace {
+
+struct Case {
+    const char* text;
+    double (*native)(double, double);
+};
+
+const Case CASES[] = {
+    { "x + y", [](double x, double y) { return x + y; } },
+    { "-50*(y - cos(x))", [](double x, double y) { return -50.0 * (y - std::cos(x)); } },
+    { "x*y^2 - y/(1 + x^2)", [](double x, double y) { return x * y * y - y / (1.0 + x * x); } },
+    { "(1 - x/2)*y + 3*x^3 - 2*x^2*y + x*y^2/4 - 1",
+      [](double x, double y) { return (1.0 - x / 2.0) * y + 3.0 * x * x * x - 2.0 * x * x * y + x * y * y / 4.0 - 1.0; } },
+    { "exp(-x)*sin(y) + sqrt(1 + y^2)",
+      [](double x, double y) { return std::exp(-x) * std::sin(y) + std::sqrt(1.0 + y * y); } },
+};
+
+double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename Function>
+double timeScalar(const Function& f, const std::vector<double>& x, const std::vector<double>& y, double& sum) {
+    auto start = std::chrono::steady_clock::now();
+    double total = 0.0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        total += f(x[i], y[i]);
+    }
+    double elapsed = seconds(start);
+    sum = total;
+    return elapsed;
+}
+
+double timeSolve(std::function<double(double, double)> f, double h, double& result) {
+    RungeKutta4 rk4(f);
+    rk4.setVerbose(false);
+    rk4.setParameters(0.0, 1.0, 1.0, h);
+    auto start = std::chrono::steady_clock::now();
+    rk4.solve();
+    double elapsed = seconds(start);
+    result = rk4.getResult();
+    return elapsed;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t points = (argc > 1) ? static_cast<size_t>(std::atol(argv[1])) : 1000000;
+    if (points == 0) {
+        std::cerr << "Usage: bench_expression [POINTS]" << std::endl;
+        return 2;
+    }
+
+    std::vector<double> x(points);
+    std::vector<double> y(points);
+    std::vector<double> result(points);
+    for (size_t i = 0; i < points; ++i) {
+        x[i] = 0.5 + 1e-6 * static_cast<double>(i % 1000000);
+        y[i] = 1.0 + 0.25 * std::sin(static_cast<double>(i));
+    }
+
+    std::cout << "=== Expression vs C++ (" << points << " points) ===" << std::endl;
+    std::cout << std::left << std::setw(48) << "Expression" << std::right << std::setw(6) << "Ops"
+              << std::setw(12) << "C++ ns" << std::setw(12) << "Scalar ns" << std::setw(12) << "Batch ns"
+              << std::setw(10) << "Scalar x" << std::setw(10) << "Batch x" << std::endl;
+    std::cout << std::string(110, '-') << std::endl;
+
+    for (size_t c = 0; c < sizeof(CASES) / sizeof(CASES[0]); ++c) {
+        Expression expression(CASES[c].text);
+        double nativeSum = 0.0;
+        double scalarSum = 0.0;
+
+        // Warm up both paths once before timing
+        timeScalar(CASES[c].native, x, y, nativeSum);
+        timeScalar(expression, x, y, scalarSum);
+
+        double native = timeScalar(CASES[c].native, x, y, nativeSum);
+        double scalar = timeScalar(expression, x, y, scalarSum);
+        auto start = std::chrono::steady_clock::now();
+        expression(points, x.data(), y.data(), result.data());
+        double batch = seconds(start);
+
+        double batchSum = 0.0;
+        for (size_t i = 0; i < points; ++i) {
+            batchSum += result[i];
+        }
+        if (std::abs(scalarSum - nativeSum) > 1e-9 * std::abs(nativeSum)
+            || std::abs(batchSum - nativeSum) > 1e-9 * std::abs(nativeSum)) {
+            std::cerr << "Mismatch for " << CASES[c].text << std::endl;
+            return 1;
+        }
+
+        double scale = 1e9 / static_cast<double>(points);
+        std::cout << std::left << std::setw(48) << CASES[c].text << std::right << std::setw(6)
+                  << expression.getInstructionCount() << std::fixed << std::setprecision(2)
+                  << std::setw(12) << native * scale << std::setw(12) << scalar * scale
+                  << std::setw(12) << batch * scale << std::setw(10) << scalar / native
+                  << std::setw(10) << batch / native << std::endl;
+    }
+
+    // Whole solves, where the right-hand side is one part of the cost per step
+    const double h = 1e-6;
+    std::cout << "\n=== RK4 solves of y' = f(x, y) on [0, 1], h = " << std::scientific
+              << std::setprecision(0) << h << " ===" << std::endl;
+    std::cout << std::left << std::setw(48) << "Expression" << std::right << std::setw(12) << "C++ ms"
+              << std::setw(14) << "Expression ms" << std::setw(10) << "Ratio" << std::endl;
+    std::cout << std::string(84, '-') << std::endl;
+
+    for (size_t c = 0; c < sizeof(CASES) / sizeof(CASES[0]); ++c) {
+        double nativeResult = 0.0;
+        double expressionResult = 0.0;
+        double native = timeSolve(CASES[c].native, h, nativeResult);
+        double compiled = timeSolve(Expression(CASES[c].text), h, expressionResult);
+        if (nativeResult != expressionResult) {
+            std::cerr << "Mismatch for " << CASES[c].text << std::endl;
+            return 1;
+        }
+        std::cout << std::left << std::setw(48) << CASES[c].text << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(12) << native * 1e3 << std::setw(14)
+                  << compiled * 1e3 << std::setw(10) << compiled / native << std::endl;
+    }
+
+    return 0;
+}
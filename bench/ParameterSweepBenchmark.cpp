@@ -0,0 +1,67 @@
+/**
+ * @file ParameterSweepBenchmark.cpp
+ * @brief Measures how a parameter sweep scales with the number of threads
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Sweeps RK4 over a grid of x0, y0, xTarget and step sizes spanning two
+ * orders of magnitude, so the cost of a grid point varies by 100x, and
+ * times the sweep with 1, 2, 4, ... threads up to the number of cores.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+#include <algorithm>
+
+#include "ParameterSweep.h"
+#include "RungeKutta4.h"
+
+int main(int argc, char* argv[]) {
+    size_t side = (argc > 1) ? static_cast<size_t>(std::atoi(argv[1])) : 8;
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+    SweepGrid grid;
+    grid.x0Values = SweepGrid::linspace(0.0, 0.5, side);
+    grid.y0Values = SweepGrid::linspace(0.5, 2.0, side);
+    grid.xTargetValues = SweepGrid::linspace(1.0, 2.0, 4);
+    grid.stepSizes.push_back(1e-3);
+    grid.stepSizes.push_back(1e-4);
+    grid.stepSizes.push_back(1e-5);
+
+    // y' = x + y through (x0, y0)
+    ParameterSweep::ExactFunction exact = [](double x0, double y0, double x) {
+        return (y0 + x0 + 1.0) * std::exp(x - x0) - x - 1.0;
+    };
+
+    std::cout << "=== Parameter sweep (" << grid.size() << " points, RK4) ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << std::left << std::setw(10) << "Threads"
+              << std::setw(14) << "Time (s)"
+              << std::setw(12) << "Speedup"
+              << std::setw(12) << "Steals" << std::endl;
+    std::cout << std::string(48, '-') << std::endl;
+
+    double serial = 0.0;
+    for (unsigned threads = 1; ; threads = std::min(threads * 2, cores)) {
+        ParameterSweep sweep([]() { return new RungeKutta4(); }, threads);
+        sweep.setGrid(grid);
+        sweep.setExactSolution(exact);
+        sweep.run();
+
+        if (threads == 1) {
+            serial = sweep.getWallTime();
+        }
+        std::cout << std::left << std::setw(10) << threads
+                  << std::setw(14) << sweep.getWallTime()
+                  << std::setw(12) << serial / sweep.getWallTime()
+                  << std::setw(12) << sweep.getStealCount() << std::endl;
+
+        if (threads == cores) {
+            break;
+        }
+    }
+    return 0;
+}
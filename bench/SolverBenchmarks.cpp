@@ -0,0 +1,207 @@
+/**
+ * @file SolverBenchmarks.cpp
+ * @brief Microbenchmark suite for the solvers, the exporters and the comparison
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Usage: bench_solver [--warmup N] [--reps N] [--filter TEXT]
+ *                     [--json FILE] [--compare FILE] [--trace FILE]
+ *
+ * Times solve() of every method at 1e3, 1e4 and 1e5 steps with verbose
+ * off, saveToCSV, calculateError and Utility::compareAllMethods on
+ * dy/dx = x + y from (0, 1) to x = 1. --compare prints the change of
+ * every median against a JSON file from an earlier build. --trace writes
+ * the solver spans of the whole run as a Chrome trace (instrumented builds).
+ */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <cstdio>
+#include <cstdlib>
+
+#include "BenchHarness.h"
+#include "Euler.h"
+#include "ModifiedEuler.h"
+#include "RungeKutta2.h"
+#include "RungeKutta4.h"
+#include "AdamsBashforth.h"
+#include "DormandPrince.h"
+#include "Utility.h"
+
+namespace {
+
+typedef std::function<double(double, double)> Function;
+typedef std::function<NumericalMethod*(Function)> Factory;
+
+struct MethodEntry {
+    const char* key;
+    Factory create;
+};
+
+std::vector<MethodEntry> allMethods() {
+    MethodEntry entries[] = {
+        { "euler", [](Function f) -> NumericalMethod* { return new EulersMethod(f); } },
+        { "modified_euler", [](Function f) -> NumericalMethod* { return new ModifiedEulersMethod(f); } },
+        { "rk2", [](Function f) -> NumericalMethod* { return new RungeKutta2(f); } },
+        { "rk4", [](Function f) -> NumericalMethod* { return new RungeKutta4(f); } },
+        { "adams_bashforth", [](Function f) -> NumericalMethod* { return new AdamsBashforth(f); } },
+        { "adams_bashforth_moulton", [](Function f) -> NumericalMethod* {
+            return new AdamsBashforth(f, 4, AdamsBashforth::Mode::PredictorCorrector);
+        } },
+        { "dormand_prince", [](Function f) -> NumericalMethod* { return new DormandPrince45(f); } },
+    };
+    return std::vector<MethodEntry>(entries, entries + sizeof(entries) / sizeof(entries[0]));
+}
+
+// Steps taken and differential-function calls of one solve, counted on an untimed run
+void countWork(const Factory& create, double h, double& steps, double& calls) {
+    long counter = 0;
+    std::unique_ptr<NumericalMethod> method(create([&counter](double x, double y) {
+        ++counter;
+        return differentialFunction(x, y);
+    }));
+    method->setVerbose(false);
+    method->setParameters(0.0, 1.0, 1.0, h);
+    method->solve();
+
+    // Adaptive methods take fewer steps than 1 / h
+    steps = static_cast<double>(method->getXValues().size() - 1);
+    calls = static_cast<double>(counter);
+}
+
+// Solved RK4 with the given number of steps
+std::unique_ptr<NumericalMethod> solvedRk4(long steps) {
+    std::unique_ptr<NumericalMethod> method(new RungeKutta4());
+    method->setVerbose(false);
+    method->setParameters(0.0, 1.0, 1.0, 1.0 / steps);
+    method->solve();
+    return method;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int warmup = 2;
+    int reps = 10;
+    std::string filter;
+    std::string jsonFile;
+    std::string compareFile;
+    std::string traceFile;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        if (arg == "--warmup") {
+            warmup = std::atoi(argv[i + 1]);
+        }
+        else if (arg == "--reps") {
+            reps = std::atoi(argv[i + 1]);
+        }
+        else if (arg == "--filter") {
+            filter = argv[i + 1];
+        }
+        else if (arg == "--json") {
+            jsonFile = argv[i + 1];
+        }
+        else if (arg == "--compare") {
+            compareFile = argv[i + 1];
+        }
+        else if (arg == "--trace") {
+            traceFile = argv[i + 1];
+        }
+        else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    if (!traceFile.empty()) {
+        TraceRecorder::instance().start();
+    }
+
+    BenchHarness harness(warmup, reps, filter);
+    BenchHarness::printHeader();
+
+    const long stepCounts[] = { 1000, 10000, 100000 };
+    std::vector<MethodEntry> methods = allMethods();
+
+    // solve() of every method; a fresh solver is set up outside the timing
+    for (size_t m = 0; m < methods.size(); ++m) {
+        for (size_t s = 0; s < 3; ++s) {
+            long steps = stepCounts[s];
+            double h = 1.0 / steps;
+            std::ostringstream name;
+            name << "solve/" << methods[m].key << "/" << steps;
+
+            std::unique_ptr<NumericalMethod> method;
+            const Factory& create = methods[m].create;
+            double taken, calls;
+            countWork(create, h, taken, calls);
+            harness.run(name.str(), taken, calls,
+                [&method, &create, h]() {
+                    method.reset(create(differentialFunction));
+                    method->setVerbose(false);
+                    method->setParameters(0.0, 1.0, 1.0, h);
+                },
+                [&method]() { method->solve(); });
+        }
+    }
+
+    // Exporting and error analysis of a 1e5-step trajectory
+    std::unique_ptr<NumericalMethod> trajectory = solvedRk4(100000);
+    const std::string csvFile = "bench_solver.csv";
+    NumericalMethod* solved = trajectory.get();
+    harness.run("save_to_csv/100000", 100001.0, 0.0, []() {},
+                [solved, &csvFile]() { solved->saveToCSV(csvFile); });
+    std::remove(csvFile.c_str());
+
+    solved->setCompareExact(true);
+    harness.run("save_to_csv_exact/100000", 100001.0, 0.0, []() {},
+                [solved, &csvFile]() { solved->saveToCSV(csvFile); });
+    std::remove(csvFile.c_str());
+
+    volatile double sink = 0.0;
+    harness.run("calculate_error/100000", 100001.0, 0.0, []() {},
+                [solved, &sink]() { sink = solved->calculateError(); });
+
+    // Comparison table of all methods, printed into a discarded stream
+    std::vector<std::unique_ptr<NumericalMethod> > owned;
+    std::vector<NumericalMethod*> compared;
+    for (size_t m = 0; m < methods.size(); ++m) {
+        owned.push_back(std::unique_ptr<NumericalMethod>(methods[m].create(differentialFunction)));
+        owned.back()->setVerbose(false);
+        owned.back()->setParameters(0.0, 1.0, 1.0, 0.001);
+        owned.back()->solve();
+        compared.push_back(owned.back().get());
+    }
+    std::ostringstream discarded;
+    harness.run("compare_all_methods", static_cast<double>(compared.size()), 0.0, []() {},
+        [&compared, &discarded]() {
+            std::streambuf* original = std::cout.rdbuf(discarded.rdbuf());
+            Utility::compareAllMethods(compared);
+            std::cout.rdbuf(original);
+            discarded.str("");
+        });
+
+    try {
+        if (!jsonFile.empty()) {
+            harness.saveToJSON(jsonFile);
+            std::cout << "\nResults saved to " << jsonFile << std::endl;
+        }
+        if (!traceFile.empty()) {
+            TraceRecorder::instance().save(traceFile);
+            std::cout << "Trace saved to " << traceFile << std::endl;
+        }
+        if (!compareFile.empty()) {
+            harness.printComparison(BenchHarness::loadMedians(compareFile));
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
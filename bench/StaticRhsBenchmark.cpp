@@ -0,0 +1,93 @@
+/**
+ * @file StaticRhsBenchmark.cpp
+ * @brief Compares the templated RHS path with the std::function path
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Integrates dy/dx = x + y from (0, 1) to x = 1 with each stepper, once
+ * through std::function and once through an inlinable lambda, and prints
+ * the time per step and the speedup.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <functional>
+#include <string>
+
+#include "StaticSolver.h"
+#include "RungeKutta4.h"
+
+namespace {
+
+struct Timing {
+    double seconds;
+    double result;
+};
+
+template <typename Solver>
+Timing timeSolve(Solver& solver, double h) {
+    auto start = std::chrono::steady_clock::now();
+    double result = solver.solve(0.0, 1.0, 1.0, h);
+    auto end = std::chrono::steady_clock::now();
+
+    Timing timing = { std::chrono::duration<double>(end - start).count(), result };
+    return timing;
+}
+
+template <typename Stepper>
+void compareStepper(const std::string& name, double h) {
+    // Same equation as the default differentialFunction, visible to the compiler
+    auto inlined = [](double x, double y) { return x + y; };
+    std::function<double(double, double)> erased = differentialFunction;
+
+    StaticSolver<Stepper, std::function<double(double, double)> > erasedSolver(erased);
+    StaticSolver<Stepper, decltype(inlined)> inlinedSolver(inlined);
+
+    // Warm up both paths once before timing
+    timeSolve(erasedSolver, h * 10.0);
+    timeSolve(inlinedSolver, h * 10.0);
+
+    Timing erasedTiming = timeSolve(erasedSolver, h);
+    Timing inlinedTiming = timeSolve(inlinedSolver, h);
+
+    double steps = 1.0 / h;
+    std::cout << std::left << std::setw(32) << name
+              << std::setw(18) << erasedTiming.seconds * 1e9 / steps
+              << std::setw(18) << inlinedTiming.seconds * 1e9 / steps
+              << std::setw(10) << erasedTiming.seconds / inlinedTiming.seconds
+              << inlinedTiming.result << std::endl;
+}
+
+} // namespace
+
+int main() {
+    const double h = 1e-7;
+
+    std::cout << "=== Templated RHS vs std::function (" << static_cast<long>(1.0 / h) << " steps) ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << std::left << std::setw(32) << "Method"
+              << std::setw(18) << "std::function ns"
+              << std::setw(18) << "template ns"
+              << std::setw(10) << "Speedup"
+              << "y(1)" << std::endl;
+    std::cout << std::string(88, '-') << std::endl;
+
+    compareStepper<EulerStepper>("Euler's Method", h);
+    compareStepper<ModifiedEulerStepper>("Modified Euler's Method", h);
+    compareStepper<RungeKutta2Stepper>("2nd Order Runge-Kutta Method", h);
+    compareStepper<RungeKutta4Stepper>("4th Order Runge-Kutta Method", h);
+
+    // Reference: the virtual solver, which also rounds and stores every step
+    RungeKutta4 rk4;
+    rk4.setVerbose(false);
+    rk4.setParameters(0.0, 1.0, 1.0, h);
+    auto start = std::chrono::steady_clock::now();
+    rk4.solve();
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "\nRungeKutta4::solve(): "
+              << std::chrono::duration<double>(end - start).count() * 1e9 * h
+              << " ns per step (rounding and storage included)" << std::endl;
+
+    return 0;
+}
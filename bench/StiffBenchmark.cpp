@@ -0,0 +1,282 @@
+/**
+ * @file StiffBenchmark.cpp
+ * @brief Steps and evaluations of the implicit methods and RK4 on stiff problems
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Usage: bench_stiff [TARGET_ERROR]
+ *
+ * Problem 1 is dy/dx = -1000 * (y - cos x) - sin x, y(0) = 0, on [0, 10],
+ * with exact solution cos x - exp(-1000 x). The fixed-step methods double
+ * their number of steps, and BDF tightens its tolerance, until the error
+ * at x = 10 is below TARGET_ERROR (default 1e-4).
+ *
+ * Problem 2 is Robertson's chemical kinetics on [0, 40]. RK4 doubles its
+ * number of steps until it agrees with BDF at a tight tolerance to a
+ * relative 1e-4; its step size is bounded by stability, not accuracy.
+ *
+ * Problem 3 is the Van der Pol oscillator with mu = 1000 on [0, 3000],
+ * stiff along its slow branches and non-stiff in the fast jumps between
+ * them. BDF alone is compared with the switching solver, whose phases are
+ * listed.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+#include "RungeKutta4.h"
+#include "BackwardEuler.h"
+#include "Trapezoidal.h"
+#include "BDF.h"
+#include "SwitchingMethod.h"
+
+namespace {
+
+const double STIFFNESS = 1000.0;
+const double DECAY_END = 10.0;
+const double KINETICS_END = 40.0;
+const double MU = 1000.0;
+const double OSCILLATOR_END = 3000.0;
+const int MAX_STEPS = 1 << 22;
+
+struct Outcome {
+    std::string method;
+    long steps;
+    long evaluations;
+    long jacobians;
+    long factorizations;
+    double error;
+    double milliseconds;
+    bool reached;
+};
+
+void decay(double x, const double* y, double* dydx) {
+    dydx[0] = -STIFFNESS * (y[0] - std::cos(x)) - std::sin(x);
+}
+
+double decayExact(double x) {
+    return std::cos(x) - std::exp(-STIFFNESS * x);
+}
+
+// Robertson: A -> B (0.04), 2B -> B + C (3e7), B + C -> A + C (1e4)
+void robertson(double, const double* y, double* dydx) {
+    dydx[0] = -0.04 * y[0] + 1e4 * y[1] * y[2];
+    dydx[1] = 0.04 * y[0] - 1e4 * y[1] * y[2] - 3e7 * y[1] * y[1];
+    dydx[2] = 3e7 * y[1] * y[1];
+}
+
+void robertsonJacobian(double, const double* y, double* dfdy) {
+    dfdy[0] = -0.04;
+    dfdy[1] = 1e4 * y[2];
+    dfdy[2] = 1e4 * y[1];
+    dfdy[3] = 0.04;
+    dfdy[4] = -1e4 * y[2] - 6e7 * y[1];
+    dfdy[5] = -1e4 * y[1];
+    dfdy[6] = 0.0;
+    dfdy[7] = 6e7 * y[1];
+    dfdy[8] = 0.0;
+}
+
+// Van der Pol: y'' = mu * (1 - y^2) * y' - y
+void vanDerPol(double, const double* y, double* dydx) {
+    dydx[0] = y[1];
+    dydx[1] = MU * (1.0 - y[0] * y[0]) * y[1] - y[0];
+}
+
+// Solve the system and fill in the counts; evaluations counted by wrapping f
+Outcome run(NumericalMethod& method, SystemFunction f, const std::vector<double>& y0, double xEnd,
+            double h, long& calls) {
+    calls = 0;
+    method.setVerbose(false);
+    method.setSystemFunction([f, &calls](double x, const double* y, double* dydx) {
+        ++calls;
+        f(x, y, dydx);
+    });
+    method.setParameters(0.0, y0, xEnd, h);
+
+    auto start = std::chrono::steady_clock::now();
+    method.solveSystem();
+    auto stop = std::chrono::steady_clock::now();
+
+    Outcome outcome;
+    outcome.method = method.getMethodName();
+    outcome.steps = static_cast<long>(method.getXValues().size()) - 1;
+    outcome.evaluations = calls;
+    outcome.jacobians = 0;
+    outcome.factorizations = 0;
+    outcome.error = 0.0;
+    outcome.milliseconds = std::chrono::duration<double, std::milli>(stop - start).count();
+    outcome.reached = false;
+
+    ImplicitMethod* implicit = dynamic_cast<ImplicitMethod*>(&method);
+    if (implicit != NULL) {
+        outcome.jacobians = implicit->getJacobianEvaluations();
+        outcome.factorizations = implicit->getFactorizations();
+    }
+    return outcome;
+}
+
+// Double the steps of a fixed-step method until the error is below target
+Outcome fixedStepDecay(NumericalMethod& method, double target) {
+    std::vector<double> y0(1, 0.0);
+    Outcome outcome;
+    for (long steps = 1; steps <= MAX_STEPS; steps *= 2) {
+        long calls = 0;
+        try {
+            outcome = run(method, decay, y0, DECAY_END, DECAY_END / steps, calls);
+        }
+        catch (const std::exception&) {
+            continue;   // Newton failed at this step size
+        }
+        outcome.error = std::abs(method.getStateResult()[0] - decayExact(DECAY_END));
+        if (outcome.error <= target) {
+            outcome.reached = true;
+            return outcome;
+        }
+    }
+    return outcome;
+}
+
+// Tighten the BDF tolerance until the error is below target
+Outcome adaptiveDecay(BDF& method, double target) {
+    std::vector<double> y0(1, 0.0);
+    Outcome outcome;
+    for (double tol = 1e-2; tol >= 1e-12; tol /= 10.0) {
+        long calls = 0;
+        method.setTolerances(tol, tol);
+        outcome = run(method, decay, y0, DECAY_END, 1e-3, calls);
+        outcome.error = std::abs(method.getStateResult()[0] - decayExact(DECAY_END));
+        if (outcome.error <= target) {
+            outcome.reached = true;
+            return outcome;
+        }
+    }
+    return outcome;
+}
+
+double relativeDifference(const std::vector<double>& a, const std::vector<double>& b) {
+    double difference = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (!std::isfinite(a[i])) {
+            return INFINITY;
+        }
+        difference = std::max(difference, std::abs(a[i] - b[i]) / std::max(std::abs(b[i]), 1e-6));
+    }
+    return difference;
+}
+
+void printHeader(const std::string& title) {
+    std::cout << "\n" << title << "\n";
+    std::cout << std::left << std::setw(42) << "Method" << std::right << std::setw(10) << "Steps"
+              << std::setw(12) << "f calls" << std::setw(11) << "Jacobians" << std::setw(8) << "LU"
+              << std::setw(12) << "Error" << std::setw(12) << "Time (ms)" << "\n";
+    std::cout << std::string(107, '-') << "\n";
+}
+
+void printOutcome(const Outcome& outcome) {
+    std::cout << std::left << std::setw(42) << outcome.method << std::right << std::setw(10)
+              << outcome.steps << std::setw(12) << outcome.evaluations << std::setw(11)
+              << outcome.jacobians << std::setw(8) << outcome.factorizations << std::setw(12)
+              << std::scientific << std::setprecision(2) << outcome.error << std::setw(12)
+              << std::fixed << std::setprecision(3) << outcome.milliseconds
+              << (outcome.reached ? "" : "  (target not reached)") << "\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    double target = (argc > 1) ? std::atof(argv[1]) : 1e-4;
+    if (!(target > 0.0)) {
+        target = 1e-4;
+    }
+
+    // Problem 1: stiff decay towards cos x
+    printHeader("dy/dx = -1000 (y - cos x) - sin x on [0, 10], error at x = 10 below "
+                + std::to_string(target));
+    RungeKutta4 rk4;
+    BackwardEuler backwardEuler;
+    Trapezoidal trapezoidal;
+    BDF bdf;
+    Outcome rk4Decay = fixedStepDecay(rk4, target);
+    printOutcome(rk4Decay);
+    printOutcome(fixedStepDecay(backwardEuler, target));
+    printOutcome(fixedStepDecay(trapezoidal, target));
+    Outcome bdfDecay = adaptiveDecay(bdf, target);
+    printOutcome(bdfDecay);
+
+    // Problem 2: Robertson kinetics, against a tight BDF reference
+    std::vector<double> y0(3, 0.0);
+    y0[0] = 1.0;
+    long calls = 0;
+
+    BDF reference;
+    reference.setTolerances(1e-12, 1e-10);
+    reference.setSystemJacobian(robertsonJacobian);
+    run(reference, robertson, y0, KINETICS_END, 1e-6, calls);
+    std::vector<double> exact = reference.getStateResult();
+
+    printHeader("Robertson kinetics on [0, 40], relative difference from a reference below 1e-4");
+    BDF finiteDifferences;
+    finiteDifferences.setTolerances(1e-10, 1e-6);
+    Outcome fd = run(finiteDifferences, robertson, y0, KINETICS_END, 1e-6, calls);
+    fd.method += ", FD Jacobian";
+    fd.error = relativeDifference(finiteDifferences.getStateResult(), exact);
+    fd.reached = fd.error <= 1e-4;
+    printOutcome(fd);
+
+    BDF analytic;
+    analytic.setTolerances(1e-10, 1e-6);
+    analytic.setSystemJacobian(robertsonJacobian);
+    Outcome an = run(analytic, robertson, y0, KINETICS_END, 1e-6, calls);
+    an.method += ", exact Jacobian";
+    an.error = relativeDifference(analytic.getStateResult(), exact);
+    an.reached = an.error <= 1e-4;
+    printOutcome(an);
+
+    Outcome rkKinetics;
+    for (long steps = 1024; steps <= MAX_STEPS; steps *= 2) {
+        rkKinetics = run(rk4, robertson, y0, KINETICS_END, KINETICS_END / steps, calls);
+        std::vector<double> state = rk4.getStateResult();
+        rkKinetics.error = relativeDifference(state, exact);
+        if (rkKinetics.error <= 1e-4) {
+            rkKinetics.reached = true;
+            break;
+        }
+    }
+    printOutcome(rkKinetics);
+
+    // Problem 3: Van der Pol, against a tight BDF reference
+    std::vector<double> start(2, 0.0);
+    start[0] = 2.0;
+    BDF oscillatorReference;
+    oscillatorReference.setTolerances(1e-12, 1e-10);
+    run(oscillatorReference, vanDerPol, start, OSCILLATOR_END, 1e-2, calls);
+    exact = oscillatorReference.getStateResult();
+
+    printHeader("Van der Pol, mu = 1000, on [0, 3000], tolerances 1e-6");
+    BDF oscillatorBdf;
+    Outcome implicitOnly = run(oscillatorBdf, vanDerPol, start, OSCILLATOR_END, 1e-2, calls);
+    implicitOnly.error = relativeDifference(oscillatorBdf.getStateResult(), exact);
+    implicitOnly.reached = true;
+    printOutcome(implicitOnly);
+
+    SwitchingMethod switching;
+    Outcome switched = run(switching, vanDerPol, start, OSCILLATOR_END, 1e-2, calls);
+    switched.error = relativeDifference(switching.getStateResult(), exact);
+    switched.reached = true;
+    printOutcome(switched);
+    switching.printPhases(std::cout);
+
+    std::cout << "\nStep reduction compared with RK4: "
+              << std::fixed << std::setprecision(0)
+              << static_cast<double>(rk4Decay.steps) / bdfDecay.steps << "x (problem 1), "
+              << static_cast<double>(rkKinetics.steps) / an.steps << "x (problem 2)" << std::endl;
+    return 0;
+}
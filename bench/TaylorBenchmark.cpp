@@ -0,0 +1,162 @@
+/**
+ * @file TaylorBenchmark.cpp
+ * @brief Steps and time of the Taylor series method and RK4 at matched accuracy
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Usage: bench_taylor [ORDER]
+ *
+ * For error targets of 1e-6, 1e-9 and 1e-12 at the end point, RK4 doubles
+ * its number of steps and the Taylor method of the given order (default
+ * TaylorMethod::DEFAULT_ORDER) tightens its tolerance until the error is
+ * below the target. Times are the fastest of several solves.
+ *
+ * Problem 1 is the default dy/dx = x + y, y(0) = 1, on [0, 1].
+ * Problem 2 is dy/dx = 1 + y^2, y(0) = 0, on [0, 1.5], whose solution
+ * tan x has a pole at pi/2, just past the end of the interval.
+ *
+ * RK4 runs through solveSystem so it keeps full precision.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <functional>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "RungeKutta4.h"
+#include "TaylorMethod.h"
+
+namespace {
+
+const long MAX_STEPS = 1L << 24;
+const int REPEATS = 5;
+const double TARGETS[] = { 1e-6, 1e-9, 1e-12 };
+
+struct Riccati {
+    template <typename T>
+    T operator()(const T&, const T& y) const {
+        return 1.0 + square(y);
+    }
+};
+
+struct Problem {
+    double y0;
+    double xEnd;
+    double exact;
+};
+
+struct Outcome {
+    long steps;
+    long evaluations;   // Plain evaluations for RK4, Jet evaluations for Taylor
+    double error;
+    double milliseconds;
+    bool reached;
+};
+
+// Fastest of REPEATS runs of solve
+double bestTime(const std::function<void()>& solve) {
+    double best = INFINITY;
+    for (int r = 0; r < REPEATS; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        solve();
+        best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+template <typename Rhs>
+Outcome rk4ToTarget(const Rhs& f, const Problem& problem, double target) {
+    RungeKutta4 rk4;
+    rk4.setVerbose(false);
+    long calls = 0;
+    rk4.setSystemFunction([f, &calls](double x, const double* y, double* dydx) {
+        ++calls;
+        dydx[0] = f(x, y[0]);
+    });
+    std::vector<double> y0(1, problem.y0);
+
+    Outcome outcome = { 0, 0, 0.0, 0.0, false };
+    for (long steps = 1; steps <= MAX_STEPS; steps *= 2) {
+        calls = 0;
+        rk4.setParameters(0.0, y0, problem.xEnd, problem.xEnd / steps);
+        rk4.solveSystem();
+        outcome.steps = steps;
+        outcome.evaluations = calls;
+        outcome.error = std::abs(rk4.getStateResult()[0] - problem.exact);
+        if (outcome.error <= target) {
+            outcome.reached = true;
+            break;
+        }
+    }
+    outcome.milliseconds = bestTime([&rk4]() { rk4.solveSystem(); });
+    return outcome;
+}
+
+template <typename Rhs>
+Outcome taylorToTarget(const Rhs& f, const Problem& problem, int order, double target) {
+    TaylorMethod taylor(f, order);
+    taylor.setVerbose(false);
+    taylor.setParameters(0.0, problem.y0, problem.xEnd, problem.xEnd);
+
+    Outcome outcome = { 0, 0, 0.0, 0.0, false };
+    for (double tol = target; tol >= 1e-16; tol /= 10.0) {
+        taylor.setTolerances(tol, tol);
+        taylor.solve();
+        outcome.steps = taylor.getSteps();
+        outcome.evaluations = taylor.getJetEvaluations();
+        outcome.error = std::abs(taylor.getResult() - problem.exact);
+        if (outcome.error <= target) {
+            outcome.reached = true;
+            break;
+        }
+    }
+    outcome.milliseconds = bestTime([&taylor]() { taylor.solve(); });
+    return outcome;
+}
+
+void printRow(const std::string& method, double target, const Outcome& outcome) {
+    std::cout << std::left << std::setw(36) << method << std::right << std::scientific
+              << std::setprecision(0) << std::setw(8) << target << std::setw(10) << outcome.steps
+              << std::setw(12) << outcome.evaluations << std::setw(12) << std::setprecision(2)
+              << outcome.error << std::setw(12) << std::fixed << std::setprecision(3)
+              << outcome.milliseconds << (outcome.reached ? "" : "  (target not reached)") << "\n";
+}
+
+template <typename Rhs>
+void compare(const std::string& title, const Rhs& f, const Problem& problem, int order) {
+    std::cout << "\n" << title << "\n";
+    std::cout << std::left << std::setw(36) << "Method" << std::right << std::setw(8) << "Target"
+              << std::setw(10) << "Steps" << std::setw(12) << "f calls" << std::setw(12) << "Error"
+              << std::setw(12) << "Time (ms)" << "\n";
+    std::cout << std::string(90, '-') << "\n";
+
+    std::string taylorName = TaylorMethod(order).getMethodName();
+    for (size_t t = 0; t < sizeof(TARGETS) / sizeof(TARGETS[0]); ++t) {
+        printRow("4th Order Runge-Kutta Method", TARGETS[t], rk4ToTarget(f, problem, TARGETS[t]));
+        printRow(taylorName, TARGETS[t], taylorToTarget(f, problem, order, TARGETS[t]));
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int order = (argc > 1) ? std::atoi(argv[1]) : TaylorMethod::DEFAULT_ORDER;
+    if (order < 1 || order > Jet::MAX_DEGREE) {
+        std::cerr << "Usage: bench_taylor [ORDER], ORDER from 1 to " << Jet::MAX_DEGREE << std::endl;
+        return 2;
+    }
+
+    Problem linear = { 1.0, 1.0, 2.0 * std::exp(1.0) - 2.0 };
+    compare("dy/dx = x + y on [0, 1]", DefaultEquation(), linear, order);
+
+    Problem riccati = { 0.0, 1.5, std::tan(1.5) };
+    compare("dy/dx = 1 + y^2 on [0, 1.5]", Riccati(), riccati, order);
+    std::cout << "\nf calls of the Taylor method are evaluations on Jets, one per order and step" << std::endl;
+
+    return 0;
+}
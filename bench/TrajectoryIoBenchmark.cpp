@@ -0,0 +1,103 @@
+/**
+ * @file TrajectoryIoBenchmark.cpp
+ * @brief Compares the binary trajectory format with CSV export
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Solves dy/dx = x + y with RK4 on a fine grid, then times writing the
+ * trajectory with saveToCSV and saveToBinary, and loading it back by
+ * parsing the CSV and by mapping the binary file.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "RungeKutta4.h"
+#include "TrajectoryFile.h"
+
+namespace {
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Parse the x and y columns of a saveToCSV file
+double loadCsv(const std::string& filename, std::vector<double>& xs, std::vector<double>& ys) {
+    auto start = std::chrono::steady_clock::now();
+    std::ifstream file(filename);
+    std::string line;
+    std::getline(file, line);  // Header
+
+    while (std::getline(file, line)) {
+        const char* p = line.c_str();
+        char* end;
+        std::strtol(p, &end, 10);         // Step
+        xs.push_back(std::strtod(end + 1, &end));
+        ys.push_back(std::strtod(end + 1, &end));
+    }
+    return secondsSince(start);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    double h = (argc > 1) ? std::atof(argv[1]) : 1e-6;
+    const std::string csvFile = "bench_trajectory.csv";
+    const std::string binFile = "bench_trajectory.odt";
+
+    RungeKutta4 rk4;
+    rk4.setVerbose(false);
+    rk4.setParameters(0.0, 1.0, 1.0, h);
+    rk4.solve();
+    size_t points = rk4.getXValues().size();
+
+    auto start = std::chrono::steady_clock::now();
+    rk4.saveToCSV(csvFile);
+    double csvWrite = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    rk4.saveToBinary(binFile, "x+y");
+    double binWrite = secondsSince(start);
+
+    std::vector<double> xs, ys;
+    double csvLoad = loadCsv(csvFile, xs, ys);
+
+    // Map the file and touch every value, so the pages are really read
+    start = std::chrono::steady_clock::now();
+    double checksum = 0.0;
+    {
+        TrajectoryFile trajectory(binFile);
+        ColumnView y = trajectory.getY();
+        for (size_t i = 0; i < y.size; ++i) {
+            checksum += y[i];
+        }
+    }
+    double binLoad = secondsSince(start);
+
+    std::cout << "=== Trajectory I/O (" << points << " points) ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << std::left << std::setw(12) << "Format"
+              << std::setw(16) << "Write (s)"
+              << std::setw(16) << "Load (s)" << std::endl;
+    std::cout << std::string(44, '-') << std::endl;
+    std::cout << std::left << std::setw(12) << "CSV"
+              << std::setw(16) << csvWrite
+              << std::setw(16) << csvLoad << std::endl;
+    std::cout << std::left << std::setw(12) << "Binary"
+              << std::setw(16) << binWrite
+              << std::setw(16) << binLoad << std::endl;
+    std::cout << "\nWrite speedup: " << csvWrite / binWrite
+              << "x, load speedup: " << csvLoad / binLoad << "x" << std::endl;
+    std::cout << "Checksum: " << checksum << " (" << xs.size() << " CSV rows)" << std::endl;
+
+    std::remove(csvFile.c_str());
+    std::remove(binFile.c_str());
+    return 0;
+}
@@ -1,6 +1,6 @@
 /**
  * @file AdamsBashforth.h
- * @brief Adams-Bashforth method for solving ODEs
+ * @brief Adams-Bashforth and Adams-Bashforth-Moulton methods for solving ODEs
  * @author Prathamesh Khade
  * @date 2025-06-07
  */
@@ -9,29 +9,152 @@
 #define ADAMS_BASHFORTH_H
 
 #include "NumericalMethod.h"
+#include "ErrorTolerance.h"
 
 /**
  * @class AdamsBashforth
- * @brief Implementation of Adams-Bashforth method (multi-step method)
+ * @brief Implementation of the Adams family of multi-step methods
+ *
+ * The order (1 to 5) and the mode are chosen at construction:
+ * - Explicit: the Adams-Bashforth formula, one function evaluation per step.
+ * - PredictorCorrector: Adams-Bashforth predicts, Adams-Moulton of the same
+ *   order corrects (PECE), two function evaluations per step.
+ * - Adaptive: PECE whose predictor-corrector difference (Milne's estimate)
+ *   controls the step size and picks the order between 1 and the given
+ *   order. It starts itself at order 1; a rejected step halves the step
+ *   size, interpolating the slope history, and a step doubles after a run
+ *   of small errors. A shortened last step is taken with RK4. Like
+ *   Dormand-Prince, results are kept in full precision, only the size of
+ *   the step given to setParameters is used, and it integrates backward
+ *   when xTarget < x0. It solves single equations only; solveSystem()
+ *   throws in this mode.
+ *
+ * The fixed-step modes take their first order - 1 steps with RK4. The
+ * slopes of the last steps are kept in a ring buffer, so a step moves no
+ * history.
  */
 class AdamsBashforth : public NumericalMethod {
+public:
+    /**
+     * @brief How the next value is obtained
+     */
+    enum class Mode {
+        Explicit,
+        PredictorCorrector,
+        Adaptive
+    };
+
+    static const int MIN_ORDER = 1;
+    static const int MAX_ORDER = 5;
+
+private:
+    int order;              // Order of the formulas; the highest order if adaptive
+    Mode mode;
+    // Error tolerances of the adaptive mode
+    ErrorTolerance tolerances;
+    long evaluations;       // Function evaluations in the last adaptive solve
+    int acceptedSteps;      // Accepted steps in the last adaptive solve
+    int rejectedSteps;      // Rejected steps in the last adaptive solve
+    int sharedStartupSteps; // RK4 steps taken from setStartupValues in the last solve
+
+    // Startup points supplied by the caller instead of running RK4
+    std::vector<double> startupX;
+    std::vector<double> startupY;
+
+    /**
+     * @brief Number of startup points of the current parameters (x0 and the RK4 steps)
+     */
+    int startupPoints() const;
+
+    /**
+     * @brief Compute the startup points with RK4 into caller buffers, without allocating
+     */
+    long computeStartup(double* xs, double* ys) const;
+
+    /**
+     * @brief Solve with step size and order control
+     */
+    void solveAdaptive();
+
 public:
     /**
      * @brief Constructor
      * @param diffFunc Function representing the differential equation
+     * @param orderVal Order of the method, 1 to 5
+     * @param modeVal Explicit, predictor-corrector or adaptive
      */
-    AdamsBashforth(std::function<double(double, double)> diffFunc = differentialFunction);
-    
+    AdamsBashforth(std::function<double(double, double)> diffFunc = differentialFunction,
+                   int orderVal = 4, Mode modeVal = Mode::Explicit);
+
+    /**
+     * @brief Set the error tolerances of the adaptive mode
+     * @param absTol Absolute tolerance
+     * @param relTol Relative tolerance
+     */
+    void setTolerances(double absTol, double relTol);
+
+    /**
+     * @brief Supply the startup points (x0 and order - 1 RK4 steps) instead of computing them
+     *
+     * Typically the first points of a RungeKutta4 solve of the same
+     * problem. solve() uses them only if there are enough, they start at
+     * the current x0 and y0 and are spaced by the current step size;
+     * otherwise it runs its own RK4 startup as usual. Extra points are
+     * ignored. The calls the startup took are still counted in the stats.
+     *
+     * @param xs x values of the startup points
+     * @param ys y values of the startup points
+     */
+    void setStartupValues(const std::vector<double>& xs, const std::vector<double>& ys);
+
     /**
-     * @brief Solve the differential equation using Adams-Bashforth method
+     * @brief Get the number of RK4 steps the last solve took from setStartupValues, 0 if none
+     */
+    int getSharedStartupSteps() const;
+
+    /**
+     * @brief Solve the differential equation using the Adams method
      */
     void solve() override;
-    
+
+    /**
+     * @brief Solve a system of ODEs with the fixed-step Adams method
+     *
+     * The adaptive mode supports only a single equation and throws
+     * std::runtime_error here.
+     */
+    void solveSystem() override;
+
+    /**
+     * @brief Get the order given at construction
+     */
+    int getOrder() const;
+
+    /**
+     * @brief Get the mode given at construction
+     */
+    Mode getMode() const;
+
+    /**
+     * @brief Get the number of function evaluations of the last adaptive solve
+     */
+    long getFunctionEvaluations() const;
+
+    /**
+     * @brief Get the number of accepted steps of the last adaptive solve
+     */
+    int getAcceptedSteps() const;
+
+    /**
+     * @brief Get the number of rejected steps of the last adaptive solve
+     */
+    int getRejectedSteps() const;
+
     /**
      * @brief Get the method name
-     * @return String "Adams-Bashforth Method"
+     * @return "Adams-Bashforth Method" for the default 4th order explicit method
      */
     std::string getMethodName() const override;
 };
 
-#endif // ADAMS_BASHFORTH_H
\ No newline at end of file
+#endif // ADAMS_BASHFORTH_H
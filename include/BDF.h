@@ -0,0 +1,95 @@
+/**
+ * @file BDF.h
+ * @brief Variable-order backward differentiation formulas for stiff ODEs
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef BDF_H
+#define BDF_H
+
+#include "ImplicitMethod.h"
+
+/**
+ * @class BDF
+ * @brief Adaptive BDF method of orders 1 to 5
+ *
+ * The order k formula is y_{n+1} = sum a_j * y_{n+1-j} + b * h * f_{n+1}
+ * over the last k points. The predictor extrapolates the last k + 1
+ * points, and b / (k + 1) times the predictor-corrector difference
+ * estimates the local error. From it the step size is chosen, and the
+ * same estimate for orders k - 1 and k + 1 chooses the order. The method
+ * starts itself at order 1.
+ *
+ * The step size changes only when it may grow by 20% or a step is
+ * rejected, so the LU factors can be reused in between. The past points
+ * are then moved to the new spacing by interpolation.
+ *
+ * Only the size of the step given to setParameters is used; the method
+ * integrates backward when xTarget < x0.
+ */
+class BDF : public ImplicitMethod {
+public:
+    static const int MIN_ORDER = 1;
+    static const int MAX_ORDER = 5;
+
+    /**
+     * @brief Constructor
+     * @param diffFunc Function representing the differential equation
+     * @param maxOrderVal Highest order used, 1 to 5
+     */
+    BDF(std::function<double(double, double)> diffFunc = differentialFunction, int maxOrderVal = MAX_ORDER);
+
+    /**
+     * @brief Get the highest order used
+     */
+    int getMaxOrder() const;
+
+    /**
+     * @brief Get the method name
+     * @return String "BDF Method (orders 1-5)"
+     */
+    std::string getMethodName() const override;
+
+protected:
+    void integrate(double* y) override;
+    StepFormatter stepFormatter() const override;
+
+    /**
+     * @brief Buffers of advance(), taken from the workspace once per solve
+     */
+    struct StepBuffers {
+        double* history;        // Ring of the past points
+        double* moved;          // Past points moved to a new spacing
+        double* psi;
+        double* yNew;
+        double* predicted;
+        double* slope;
+        double* difference;
+    };
+
+    /**
+     * @brief Take the buffers of advance() from the solve workspace
+     */
+    StepBuffers stepBuffers();
+
+    /**
+     * @brief Take steps from x towards xTarget, starting again at order 1
+     * @param x Start on entry, the point reached on return
+     * @param y State at x on entry, the state at the point reached on return
+     * @param h Initial step on entry, the last step on return; negative
+     *          when integrating backward, towards xTarget < x
+     * @param work Buffers from stepBuffers(), reused by every call of the solve
+     */
+    void advance(double& x, double* y, double& h, const StepBuffers& work);
+
+    /**
+     * @brief Called after every accepted step but the last; true makes advance() return
+     */
+    virtual bool stopAfterStep(double x, const double* y, double h);
+
+private:
+    int maxOrder;
+};
+
+#endif // BDF_H
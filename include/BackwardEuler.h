@@ -0,0 +1,36 @@
+/**
+ * @file BackwardEuler.h
+ * @brief Backward (implicit) Euler method for stiff ODEs
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef BACKWARD_EULER_H
+#define BACKWARD_EULER_H
+
+#include "ImplicitMethod.h"
+
+/**
+ * @class BackwardEuler
+ * @brief Fixed-step y_{n+1} = y_n + h * f(x_{n+1}, y_{n+1}), 1st order and L-stable
+ */
+class BackwardEuler : public ImplicitMethod {
+public:
+    /**
+     * @brief Constructor
+     * @param diffFunc Function representing the differential equation
+     */
+    BackwardEuler(std::function<double(double, double)> diffFunc = differentialFunction);
+
+    /**
+     * @brief Get the method name
+     * @return String "Backward Euler Method"
+     */
+    std::string getMethodName() const override;
+
+protected:
+    void integrate(double* y) override;
+    StepFormatter stepFormatter() const override;
+};
+
+#endif // BACKWARD_EULER_H
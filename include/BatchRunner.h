@@ -0,0 +1,139 @@
+/**
+ * @file BatchRunner.h
+ * @brief Runs many independent problems in one process without user interaction
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include <vector>
+#include <string>
+#include <ostream>
+#include <cstddef>
+
+/**
+ * @struct BatchJob
+ * @brief One problem of a batch and the files its results go to
+ */
+struct BatchJob {
+    std::string name;       // Label in the summary; defaults to the job number
+    std::string method;     // Short method name, see Utility::createMethod
+    std::string equation;   // Right-hand side f(x, y) as an Expression, or empty for differentialFunction
+    std::string solution;   // Exact solution y(x) as an Expression, or empty for exactSolution
+    std::string plugin;     // Shared library providing the equation, see Plugin; or empty
+    double x0;
+    double y0;
+    double xTarget;
+    double stepSize;
+    bool compareExact;      // Report the error against the exact solution; with an equation, or a
+                            // plugin without ode_plugin_exact, it needs solution
+    std::string csvFile;    // Trajectory as CSV, or empty
+    std::string binaryFile; // Trajectory as a binary trajectory file, or empty
+
+    BatchJob()
+        : method("rk4"), x0(0.0), y0(1.0), xTarget(1.0), stepSize(0.1), compareExact(false) {}
+};
+
+/**
+ * @struct BatchResult
+ * @brief Outcome of one job
+ */
+struct BatchResult {
+    std::string name;
+    std::string methodName; // Full name of the method, empty if it could not be created
+    double finalX;          // Last x reached
+    double finalY;          // Approximated y at finalX
+    double error;           // |exact - finalY|, NaN unless compareExact
+    double seconds;         // Solve and export time of the job
+    std::string message;    // Empty on success, otherwise the exception text
+};
+
+/**
+ * @class BatchRunner
+ * @brief Solves a list of jobs on a work-stealing thread pool
+ *
+ * Every job gets its own method instance, so jobs run fully in parallel.
+ * Jobs that write no trajectory stream their steps to a
+ * FinalValueObserver and keep no steps in memory.
+ */
+class BatchRunner {
+public:
+    /**
+     * @brief Constructor
+     * @param threadCount Number of worker threads, 0 for one per core
+     */
+    explicit BatchRunner(unsigned threadCount = 0);
+
+    /**
+     * @brief Append a job
+     * @param job Problem to solve
+     */
+    void addJob(const BatchJob& job);
+
+    /**
+     * @brief Append the jobs of a job file
+     *
+     * One job per line as whitespace-separated key=value pairs; the keys
+     * are name, method, equation, solution, plugin, x0, y0, xTarget, h,
+     * exact (0 or 1), csv and binary. Keys left out keep the BatchJob defaults.
+     * Expressions must not contain spaces. Blank lines and lines starting
+     * with # are skipped.
+     *
+     * @param filename Name of the job file
+     */
+    void loadJobFile(const std::string& filename);
+
+    /**
+     * @brief Get the jobs added so far
+     */
+    const std::vector<BatchJob>& getJobs() const;
+
+    /**
+     * @brief Solve every job
+     *
+     * A job that throws gets the exception text in its message; the other
+     * jobs are unaffected.
+     *
+     * @return Results in job order
+     */
+    const std::vector<BatchResult>& run();
+
+    /**
+     * @brief Get the results of the last run
+     */
+    const std::vector<BatchResult>& getResults() const;
+
+    /**
+     * @brief Get the number of failed jobs of the last run
+     */
+    size_t getFailureCount() const;
+
+    /**
+     * @brief Get the wall time of the last run in seconds
+     */
+    double getWallTime() const;
+
+    /**
+     * @brief Print a table of the results of the last run
+     * @param out Stream to print to
+     */
+    void printSummary(std::ostream& out) const;
+
+    /**
+     * @brief Save the results of the last run to a CSV file
+     * @param filename Name of the file to save to
+     */
+    void saveToCSV(const std::string& filename) const;
+
+private:
+    unsigned threads;
+    std::vector<BatchJob> jobs;
+    std::vector<BatchResult> results;
+    double wallTime;
+
+    void solveJob(size_t index);
+};
+
+#endif // BATCH_RUNNER_H
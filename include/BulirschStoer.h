@@ -0,0 +1,117 @@
+/**
+ * @file BulirschStoer.h
+ * @brief Gragg-Bulirsch-Stoer extrapolation method for solving ODEs
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef BULIRSCH_STOER_H
+#define BULIRSCH_STOER_H
+
+#include "NumericalMethod.h"
+#include "ErrorTolerance.h"
+
+/**
+ * @class BulirschStoer
+ * @brief Extrapolation method with adaptive order and step size
+ *
+ * Each step of size H runs Gragg's modified midpoint rule with 2, 4, 6, ...
+ * substeps. The error of the midpoint rule is a series in even powers of
+ * the substep, so polynomial extrapolation to zero substep (Aitken-Neville)
+ * gains two orders per column of the table. The difference of the last two
+ * entries of the diagonal estimates the error.
+ *
+ * A step is accepted as soon as a column near the target column meets the
+ * tolerances, and rejected early when the error is too large for the
+ * remaining columns to fix. From the work per unit step of the last
+ * columns, the next target column and step size are chosen as in ODEX
+ * (Hairer, Norsett & Wanner, Solving ODEs I, II.9).
+ *
+ * The same code solves single equations and systems. Results are kept in
+ * full precision; the method is meant for tight tolerances. Only the size
+ * of the initial step is used, and it integrates backward when xTarget < x0.
+ */
+class BulirschStoer : public NumericalMethod {
+public:
+    /**
+     * @brief Highest number of columns of the extrapolation table
+     */
+    static const int MAX_COLUMNS = 9;
+
+private:
+    ErrorTolerance tolerances;
+    long evaluations;       // Function evaluations in the last solve
+    int acceptedSteps;      // Accepted steps in the last solve
+    int rejectedSteps;      // Rejected steps in the last solve
+    bool systemSolve;       // True while solving a system
+    size_t size;            // Components of the current solve; 1 for a single equation
+    Workspace* buffers;     // Workspace of the current solve
+
+    /**
+     * @brief Integrate from x0 to xTarget; y holds the initial state
+     *
+     * Called between beginSolve() and endSolve(), with buffers set.
+     */
+    void integrate(double* y);
+
+    /**
+     * @brief Modified midpoint rule over [x, x + H] with the given number of substeps
+     * @param f0 f(x, y), shared by every call of a step
+     * @param result Receives the smoothed end value
+     */
+    void midpoint(double x, const double* y, const double* f0, double bigStep, int substeps,
+                  double* result, double* previous, double* current, double* slope);
+
+    /**
+     * @brief Evaluate f(x, y) for the current problem
+     */
+    void evaluate(double x, const double* y, double* dydx);
+
+
+public:
+    /**
+     * @brief Constructor
+     * @param diffFunc Function representing the differential equation
+     */
+    BulirschStoer(std::function<double(double, double)> diffFunc = differentialFunction);
+
+    /**
+     * @brief Set the error tolerances
+     * @param absTol Absolute tolerance
+     * @param relTol Relative tolerance
+     */
+    void setTolerances(double absTol, double relTol);
+
+    /**
+     * @brief Solve the single differential equation
+     */
+    void solve() override;
+
+    /**
+     * @brief Solve the system of differential equations
+     */
+    void solveSystem() override;
+
+    /**
+     * @brief Get the number of function evaluations of the last solve
+     */
+    long getFunctionEvaluations() const;
+
+    /**
+     * @brief Get the number of accepted steps of the last solve
+     */
+    int getAcceptedSteps() const;
+
+    /**
+     * @brief Get the number of rejected steps of the last solve
+     */
+    int getRejectedSteps() const;
+
+    /**
+     * @brief Get the method name
+     * @return String "Bulirsch-Stoer Method"
+     */
+    std::string getMethodName() const override;
+};
+
+#endif // BULIRSCH_STOER_H
@@ -0,0 +1,69 @@
+/**
+ * @file CsvWriter.h
+ * @brief Buffered, multi-threaded CSV exporter for trajectories
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef CSV_WRITER_H
+#define CSV_WRITER_H
+
+#include <string>
+#include <functional>
+#include <cstddef>
+
+/**
+ * @class CsvWriter
+ * @brief Writes trajectories in the `Step,x,y[,exact,error]` layout
+ *
+ * Rows are formatted in chunks, in parallel when there are enough of them,
+ * and the chunks are written to the file in order with large unbuffered
+ * writes. The output is byte-for-byte identical to formatting every value
+ * with `std::fixed << std::setprecision(4)`.
+ */
+class CsvWriter {
+public:
+    /**
+     * @brief Longest output of formatFixed4 (sign, 309 digits, point, 4 decimals)
+     */
+    static const size_t MAX_FIXED4_LENGTH = 316;
+
+    /**
+     * @brief Format a value with exactly 4 decimal places
+     *
+     * Produces the same characters as printf("%.4f"). Values far from a
+     * rounding tie are formatted with integer arithmetic; ties, very large
+     * values and non-finite values go through snprintf.
+     *
+     * @param value Value to format
+     * @param out Buffer with room for MAX_FIXED4_LENGTH + 1 characters
+     * @return Pointer one past the last character written
+     */
+    static char* formatFixed4(double value, char* out);
+
+    /**
+     * @brief Quote a text field, doubling the quotes inside it
+     * @param field Text of the field
+     * @return The field between double quotes
+     */
+    static std::string quote(const std::string& field);
+
+    /**
+     * @brief Write a trajectory to a CSV file
+     * @param filename Name of the file to write to
+     * @param x x values, `count` of them
+     * @param y States, `count` rows of `dimension` values
+     * @param count Number of rows
+     * @param dimension Components per state; 1 writes the `y` column,
+     *                  larger values write `y0,y1,...`
+     * @param exact Exact solution for the `exact,error` columns, or empty
+     *              to leave them out (scalar trajectories only). It is
+     *              called once per row, on the calling thread.
+     * @param threads Number of formatting threads, 0 for one per core
+     */
+    static void write(const std::string& filename, const double* x, const double* y,
+                      size_t count, size_t dimension,
+                      const std::function<double(double)>& exact, unsigned threads = 0);
+};
+
+#endif // CSV_WRITER_H
@@ -0,0 +1,93 @@
+/**
+ * @file DormandPrince.h
+ * @brief Adaptive Dormand-Prince 5(4) method for solving ODEs
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef DORMAND_PRINCE_H
+#define DORMAND_PRINCE_H
+
+#include "NumericalMethod.h"
+#include "ErrorTolerance.h"
+
+/**
+ * @class DormandPrince45
+ * @brief Embedded Runge-Kutta 5(4) method with adaptive step size
+ *
+ * The step size given to setParameters is only the initial guess, and only
+ * its size is used; the method integrates backward when xTarget < x0. Each
+ * step is accepted when the embedded error estimate meets the tolerances,
+ * and the next step size comes from a PI controller. The last stage of an
+ * accepted step is reused as the first stage of the next (FSAL), so an
+ * accepted step costs 6 function evaluations.
+ *
+ * Results are kept in full precision; the error control would be
+ * meaningless on values rounded to 4 decimal places.
+ */
+class DormandPrince45 : public NumericalMethod {
+private:
+    ErrorTolerance tolerances;
+    long evaluations;       // Function evaluations in the last solve
+    int acceptedSteps;      // Accepted steps in the last solve
+    int rejectedSteps;      // Rejected steps in the last solve
+
+public:
+    /**
+     * @brief Constructor
+     * @param diffFunc Function representing the differential equation
+     */
+    DormandPrince45(std::function<double(double, double)> diffFunc = differentialFunction);
+
+    /**
+     * @brief Set the error tolerances
+     * @param absTol Absolute tolerance
+     * @param relTol Relative tolerance
+     */
+    void setTolerances(double absTol, double relTol);
+
+    /**
+     * @brief Solve the differential equation using the adaptive Dormand-Prince method
+     */
+    void solve() override;
+
+    /**
+     * @brief Get the number of function evaluations of the last solve
+     */
+    long getFunctionEvaluations() const;
+
+    /**
+     * @brief Get the number of accepted steps of the last solve
+     */
+    int getAcceptedSteps() const;
+
+    /**
+     * @brief Get the number of rejected steps of the last solve
+     */
+    int getRejectedSteps() const;
+
+    /**
+     * @brief Report the function evaluations saved compared with RK4
+     *
+     * Runs fixed-step RK4 with halving step sizes until its maximum error
+     * against exactSolution is no larger than that of the last solve, then
+     * prints both evaluation counts.
+     *
+     * @return Evaluations saved, or -1 if RK4 did not reach the accuracy
+     */
+    long reportSavings() const;
+
+    /**
+     * @brief Get the method name
+     * @return String "Dormand-Prince 5(4) Method"
+     */
+    std::string getMethodName() const override;
+
+protected:
+    /**
+     * @brief Interpolate inside step i with the method's continuous extension
+     */
+    double interpolateStep(size_t i, double theta) const override;
+};
+
+#endif // DORMAND_PRINCE_H
@@ -0,0 +1,38 @@
+/**
+ * @file DormandPrinceTableau.h
+ * @brief Coefficients and step size controller of the Dormand-Prince 5(4) pair
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef DORMAND_PRINCE_TABLEAU_H
+#define DORMAND_PRINCE_TABLEAU_H
+
+/**
+ * @struct DormandPrinceTableau
+ * @brief Butcher tableau, error weights and PI controller settings
+ *
+ * Shared by DormandPrince45 and the explicit phases of SwitchingMethod and
+ * defined in DormandPrince.cpp. Row s of A and entry s of C give stage
+ * s + 2; the last row of A holds the weights of the 5th order solution,
+ * whose slope is the 7th stage (FSAL).
+ */
+struct DormandPrinceTableau {
+    static const double C[6];
+    static const double A[6][6];
+
+    /**
+     * @brief Difference between the 5th and 4th order weights, one per stage
+     */
+    static const double E[7];
+
+    // PI controller (Hairer, Norsett & Wanner, Solving ODEs I, II.4)
+    static const double SAFETY;
+    static const double ALPHA;
+    static const double BETA;
+    static const double MIN_FACTOR;     // Largest shrink of the step in one go
+    static const double MAX_FACTOR;     // Largest growth of the step in one go
+    static const int MAX_STEPS = 10000000;
+};
+
+#endif // DORMAND_PRINCE_TABLEAU_H
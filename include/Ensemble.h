@@ -0,0 +1,151 @@
+/**
+ * @file Ensemble.h
+ * @brief Lockstep integration of many initial conditions with SIMD kernels
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef ENSEMBLE_H
+#define ENSEMBLE_H
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <cstddef>
+#include "Workspace.h"
+
+/**
+ * @brief Batched right-hand side: dydx[i] = f(x[i], y[i]) for i < count
+ *
+ * The callee evaluates a whole lane of ensemble members at once, so a
+ * single call replaces `count` scalar calls through std::function.
+ */
+typedef std::function<void(size_t count, const double* x, const double* y, double* dydx)> BatchFunction;
+
+/**
+ * @brief Default batched right-hand side, dy/dx = x + y on each member
+ *
+ * Written out rather than calling differentialFunction, which lives in
+ * another translation unit, so the loop can be vectorized. Keep the two
+ * in sync.
+ */
+inline void batchDifferentialFunction(size_t count, const double* x, const double* y, double* dydx) {
+    for (size_t i = 0; i < count; ++i) {
+        dydx[i] = x[i] + y[i];
+    }
+}
+
+/**
+ * @class EnsembleSolver
+ * @brief Integrates a batch of (x0, y0) pairs of the same equation in lockstep
+ *
+ * Members are kept in structure-of-arrays form and advanced together with
+ * AVX-512 or AVX2 kernels when the CPU supports them, falling back to a
+ * scalar kernel otherwise. The kernel set is chosen once at runtime, and
+ * setKernel() forces another one for comparisons.
+ *
+ * Results are kept in full precision whatever the PRECISION build option:
+ * they agree with solveSystem() of the matching method to rounding error,
+ * but not with solve() in a classroom build, which rounds every step to
+ * 4 decimal places.
+ */
+class EnsembleSolver {
+public:
+    /**
+     * @brief Explicit schemes available in ensemble mode
+     */
+    enum class Scheme {
+        Euler,
+        ModifiedEuler,
+        RungeKutta2,
+        RungeKutta4
+    };
+
+    /**
+     * @brief Constructor
+     * @param schemeVal Explicit scheme used to advance every member
+     * @param batchFunc Batched function representing the differential equation
+     */
+    EnsembleSolver(Scheme schemeVal = Scheme::RungeKutta4, BatchFunction batchFunc = batchDifferentialFunction);
+
+    /**
+     * @brief Set the initial conditions of all members
+     * @param x0Vals Initial x of each member
+     * @param y0Vals Initial y of each member
+     * @param interval Length of the integration interval, the same for every member
+     * @param stepSizeVal Step size h
+     */
+    void setParameters(const std::vector<double>& x0Vals, const std::vector<double>& y0Vals,
+                       double interval, double stepSizeVal);
+
+    /**
+     * @brief Advance all members to x0 + interval
+     */
+    void solve();
+
+    /**
+     * @brief Get the final x of every member
+     * @return Vector of x values, one per member
+     */
+    const std::vector<double>& getXValues() const;
+
+    /**
+     * @brief Get the final y of every member
+     * @return Vector of y values, one per member
+     */
+    const std::vector<double>& getYValues() const;
+
+    /**
+     * @brief Get the number of members in the ensemble
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get the name of the scheme
+     * @return String with the method name
+     */
+    std::string getMethodName() const;
+
+    /**
+     * @brief Get the name of the kernel set selected for this CPU
+     * @return "avx512", "avx2" or "scalar"
+     */
+    static const char* getKernelName();
+
+    /**
+     * @brief Get the names of the kernel sets this CPU can run, fastest first
+     */
+    static std::vector<std::string> getAvailableKernels();
+
+    /**
+     * @brief Force a kernel set for this solver
+     * @param name One of getAvailableKernels(), or "auto" for getKernelName()
+     */
+    void setKernel(const std::string& name);
+
+    /**
+     * @brief Get the name of the kernel set this solver uses
+     */
+    const char* getKernel() const;
+
+private:
+    Scheme scheme;
+    BatchFunction batchFunction;
+    int kernel;             // Index into the available kernel sets, -1 for the CPU's choice
+    double stepSize;
+    int steps;
+
+    // Structure-of-arrays state of all members
+    std::vector<double> xValues;
+    std::vector<double> yValues;
+
+    // Stage buffers, kept between solves
+    Workspace workspace;
+
+    /**
+     * @brief Advance members [begin, begin + count) through all steps
+     */
+    void solveBlock(size_t begin, size_t count, double* work);
+};
+
+#endif // ENSEMBLE_H
@@ -0,0 +1,69 @@
+/**
+ * @file ErrorTolerance.h
+ * @brief Absolute and relative error tolerances of the adaptive methods
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef ERROR_TOLERANCE_H
+#define ERROR_TOLERANCE_H
+
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+
+/**
+ * @struct ErrorTolerance
+ * @brief Tolerance pair and the error scale built from it
+ *
+ * A component y_i has the error scale abs + rel * max(|y_i,old|, |y_i,new|);
+ * a step is accepted when every error divided by its scale is at most 1.
+ */
+struct ErrorTolerance {
+    double absolute;
+    double relative;
+
+    ErrorTolerance() : absolute(1e-6), relative(1e-6) {}
+
+    /**
+     * @brief Set both tolerances; at least one must be positive
+     */
+    void set(double absTol, double relTol) {
+        if (absTol <= 0.0 && relTol <= 0.0) {
+            throw std::invalid_argument("At least one tolerance must be positive");
+        }
+        absolute = absTol;
+        relative = relTol;
+    }
+
+    /**
+     * @brief Error scale of one component
+     */
+    double scale(double yOld, double yNew) const {
+        return absolute + relative * std::max(std::abs(yOld), std::abs(yNew));
+    }
+
+    /**
+     * @brief Error of each of n components relative to its scale, maximum over the components
+     */
+    double scaledNorm(size_t n, const double* e, const double* yOld, const double* yNew) const {
+        double norm = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            norm = std::max(norm, std::abs(e[i]) / scale(yOld[i], yNew[i]));
+        }
+        return norm;
+    }
+
+    /**
+     * @brief Write the "Tolerances: abs = ..., rel = ..." line of the verbose output
+     */
+    void print(std::ostream& out) const {
+        out << "Tolerances: abs = " << std::scientific << std::setprecision(1) << absolute
+            << ", rel = " << relative << std::endl;
+    }
+};
+
+#endif // ERROR_TOLERANCE_H
@@ -27,6 +27,11 @@ public:
      */
     void solve() override;
     
+    /**
+     * @brief Solve a system of ODEs using Euler's method
+     */
+    void solveSystem() override;
+    
     /**
      * @brief Get the method name
      * @return String "Euler's Method"
@@ -0,0 +1,106 @@
+/**
+ * @file Expression.h
+ * @brief Right-hand sides given as text, compiled to register bytecode
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class Expression
+ * @brief Function f(x, y) parsed from text such as "x*y + sin(x)"
+ *
+ * The text may use the variables x and y, numbers, the constants pi and e,
+ * the operators + - * / ^ (right associative) and the functions sin, cos,
+ * tan, asin, acos, atan, sinh, cosh, tanh, exp, log (or ln), log10, sqrt,
+ * abs, pow, atan2, min and max. Parse errors throw std::invalid_argument
+ * with the position of the error.
+ *
+ * The constructor folds constant subexpressions, applies only identities
+ * that give the same double for every x (x * 1, x - 0, x ^ 2 = x * x,
+ * x / 4 = x * 0.25, x + -y = x - y, ...; not x + 0, which is wrong for
+ * x = -0, nor x ^ 3 = x * x * x, which rounds twice) and shares repeated
+ * subexpressions. What is left is compiled into
+ * instructions working on a register file that holds x, y, the constants
+ * and the temporaries.
+ *
+ * An Expression is a callable: it can be passed wherever a
+ * std::function<double(double, double)> is expected, such as the
+ * constructor of every NumericalMethod, and its batch form matches the
+ * BatchFunction of Ensemble. Evaluation does not modify the object, so
+ * one Expression can be used from several threads.
+ */
+class Expression {
+public:
+    /**
+     * @brief Parse and compile an expression
+     * @param text Expression in x and y
+     */
+    explicit Expression(const std::string& text);
+
+    /**
+     * @brief Evaluate at one point
+     */
+    double operator()(double x, double y) const;
+
+    /**
+     * @brief Evaluate at count points, running each instruction over a block of points at a time
+     * @param count Number of points
+     * @param x x values of the points
+     * @param y y values of the points
+     * @param result Receives the values; may alias neither x nor y
+     */
+    void operator()(size_t count, const double* x, const double* y, double* result) const;
+
+    /**
+     * @brief Get the text the expression was compiled from
+     */
+    const std::string& getText() const;
+
+    /**
+     * @brief True if the simplified expression depends on y
+     */
+    bool usesY() const;
+
+    /**
+     * @brief Get the number of instructions of the bytecode
+     */
+    size_t getInstructionCount() const;
+
+    /**
+     * @brief Get a readable listing of the bytecode, one instruction per line
+     */
+    std::string disassemble() const;
+
+    /**
+     * @brief Most registers an expression may need
+     */
+    static const unsigned MAX_REGISTERS = 256;
+
+private:
+    /**
+     * @brief One instruction: registers[dst] = op(registers[a], registers[b])
+     */
+    struct Instruction {
+        uint8_t op;
+        uint8_t dst;
+        uint8_t a;
+        uint8_t b;
+    };
+
+    std::string text;
+    std::vector<Instruction> code;
+    std::vector<double> constants;  // Registers 2 onwards; x and y are registers 0 and 1
+    unsigned registerCount;
+    unsigned resultRegister;
+    bool dependsOnY;
+};
+
+#endif // EXPRESSION_H
@@ -0,0 +1,193 @@
+/**
+ * @file ImplicitMethod.h
+ * @brief Base class of the implicit methods for stiff ODEs
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef IMPLICIT_METHOD_H
+#define IMPLICIT_METHOD_H
+
+#include "NumericalMethod.h"
+#include "ErrorTolerance.h"
+
+/**
+ * @brief Jacobian df/dy of a system, written row by row into dfdy (n x n)
+ */
+typedef std::function<void(double x, const double* y, double* dfdy)> SystemJacobian;
+
+/**
+ * @class ImplicitMethod
+ * @brief Newton iteration shared by the implicit methods
+ *
+ * Every step solves y = psi + gamma * h * f(x, y) for y with a simplified
+ * Newton iteration on the matrix I - gamma * h * J. The Jacobian J is kept
+ * across steps and the matrix is factorized again only when gamma * h or
+ * J changes. J is evaluated again only when the iteration converges slowly
+ * or fails with an old J. Without an analytic Jacobian, J comes from
+ * forward differences, one function evaluation per component.
+ *
+ * The same code solves single equations and systems. Results are kept in
+ * full precision; the Newton convergence test would be meaningless on
+ * values rounded to 4 decimal places.
+ */
+class ImplicitMethod : public NumericalMethod {
+public:
+    /**
+     * @brief Constructor
+     * @param diffFunc Function representing the differential equation
+     */
+    ImplicitMethod(std::function<double(double, double)> diffFunc = differentialFunction);
+
+    /**
+     * @brief Set the analytic df/dy of the single equation; empty for finite differences
+     */
+    void setJacobian(std::function<double(double, double)> dfdy);
+
+    /**
+     * @brief Set the analytic Jacobian of the system; empty for finite differences
+     */
+    void setSystemJacobian(SystemJacobian dfdy);
+
+    /**
+     * @brief Set the tolerances of the Newton iteration and of the step size control
+     * @param absTol Absolute tolerance
+     * @param relTol Relative tolerance
+     */
+    void setTolerances(double absTol, double relTol);
+
+    /**
+     * @brief Solve the single differential equation
+     */
+    void solve() override;
+
+    /**
+     * @brief Solve the system of differential equations
+     */
+    void solveSystem() override;
+
+    /**
+     * @brief Get the number of function evaluations of the last solve, Jacobians included
+     */
+    long getFunctionEvaluations() const;
+
+    /**
+     * @brief Get the number of Jacobian evaluations of the last solve
+     */
+    long getJacobianEvaluations() const;
+
+    /**
+     * @brief Get the number of LU factorizations of the last solve
+     */
+    long getFactorizations() const;
+
+    /**
+     * @brief Get the number of Newton iterations of the last solve
+     */
+    long getNewtonIterations() const;
+
+    /**
+     * @brief Get the number of accepted steps of the last solve
+     */
+    int getAcceptedSteps() const;
+
+    /**
+     * @brief Get the number of rejected steps of the last solve
+     */
+    int getRejectedSteps() const;
+
+protected:
+    ErrorTolerance tolerances;
+    bool adaptive;              // True if stepSize is only the initial step size
+    size_t size;                // Components of the current solve; 1 for a single equation
+    long evaluations;
+    long jacobianEvaluations;
+    long factorizations;
+    long newtonIterations;
+    int acceptedSteps;
+    int rejectedSteps;
+
+    /**
+     * @brief Integrate from x0 to xTarget; y holds the initial state
+     *
+     * Called by solve() and solveSystem() between beginSolve() and
+     * endSolve(), with the Newton buffers ready.
+     */
+    virtual void integrate(double* y) = 0;
+
+    /**
+     * @brief Formatter of the verbose output of single equations
+     */
+    virtual StepFormatter stepFormatter() const = 0;
+
+    /**
+     * @brief Evaluate f(x, y) for the current problem
+     */
+    void evaluate(double x, const double* y, double* dydx);
+
+    /**
+     * @brief Solve y = psi + gammaH * f(x, y), starting from the guess in y
+     * @param x Abscissa of the new point
+     * @param psi Known part of the formula
+     * @param gammaH Factor of f
+     * @param y Guess on entry, solution on success
+     * @return False if Newton's method did not converge even with a new Jacobian
+     */
+    bool newtonSolve(double x, const double* psi, double gammaH, double* y);
+
+    /**
+     * @brief Evaluate J at (x, y) for the next steps and return its infinity norm
+     *
+     * The norm bounds the magnitude of every eigenvalue of J.
+     */
+    double jacobianNorm(double x, const double* y);
+
+
+    /**
+     * @brief Take fixed steps of the theta method
+     *
+     * y_{n+1} = y_n + h * ((1 - theta) * f_n + theta * f_{n+1}); theta = 1 is
+     * backward Euler and theta = 1/2 the trapezoidal rule.
+     */
+    void integrateTheta(double* y, double theta);
+
+    /**
+     * @brief Record an accepted step and trace it for a single equation
+     */
+    void acceptStep(double xStart, double x, const double* y, double h, double errorEstimate);
+
+    /**
+     * @brief Trace a rejected step of a single equation
+     */
+    void traceRejected(double x, const double* y, double hNew);
+
+    /**
+     * @brief Get a buffer of count doubles from the solve workspace
+     */
+    double* scratch(size_t count);
+
+private:
+    std::function<double(double, double)> jacobian;
+    SystemJacobian systemJacobian;
+
+    bool systemSolve;           // True while solving a system
+
+    // Newton buffers, from the solve workspace
+    Workspace* buffers;
+    double* jac;                // J, row by row
+    double* lu;                 // LU factors of I - gammaH * J
+    double* fValues;
+    double* residual;
+    double* guess;
+    double* perturbed;          // State of the finite differences
+    std::vector<size_t> pivots;
+    double factorGammaH;        // gammaH of the factors; 0 when there are none
+    bool jacobianCurrent;       // False once J should be evaluated again
+
+    void evaluateJacobian(double x, const double* y, const double* f);
+    bool factorize(double gammaH);
+    void luSolve(double* b) const;
+    void runSolve(const double* y0);
+};
+
+#endif // IMPLICIT_METHOD_H
@@ -0,0 +1,387 @@
+/**
+ * @file Instrumentation.h
+ * @brief RHS call counters, phase timers and trace export for the solvers
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Everything here is compiled in only when ODE_ENABLE_INSTRUMENTATION is
+ * defined (the ENABLE_INSTRUMENTATION CMake option). Without it the
+ * classes keep their interface but every member is an empty inline
+ * function, so the calls in the stepping loops compile to nothing.
+ */
+
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <utility>
+#include <stdint.h>
+
+#if defined(ODE_ENABLE_INSTRUMENTATION) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+/**
+ * @struct SolveStats
+ * @brief Where the time of the last setParameters, solve and export went
+ *
+ * Rounding and storage are timed on every SAMPLE_INTERVAL-th step and
+ * scaled to all steps; stepping is the rest of the solve.
+ */
+struct SolveStats {
+    long rhsCalls;              // Calls of the differential (or system) function
+    long steps;                 // Points recorded after the initial one
+    double setupSeconds;        // Last setParameters
+    double solveSeconds;        // Last solve() or solveSystem()
+    double steppingSeconds;     // Solve time not spent rounding or storing
+    double roundingSeconds;     // Rounding to 4 decimal places (estimated)
+    double storageSeconds;      // Recording steps (estimated)
+    double exportSeconds;       // Last saveToCSV or saveToBinary
+
+    SolveStats()
+        : rhsCalls(0), steps(0), setupSeconds(0.0), solveSeconds(0.0), steppingSeconds(0.0),
+          roundingSeconds(0.0), storageSeconds(0.0), exportSeconds(0.0) {}
+};
+
+/**
+ * @brief Parts of a step timed separately by PhaseSample
+ */
+enum class SolvePhase {
+    None,
+    Rounding,
+    Storage
+};
+
+/**
+ * @class TraceRecorder
+ * @brief Collects timed spans and writes them in the Chrome trace-event format
+ *
+ * Recording is off until start() is called. The JSON written by save()
+ * opens in chrome://tracing or Perfetto, with one row per thread.
+ */
+class TraceRecorder {
+public:
+    /**
+     * @brief Get the process-wide recorder
+     */
+    static TraceRecorder& instance();
+
+    /**
+     * @brief Start recording spans
+     */
+    void start();
+
+    /**
+     * @brief Stop recording spans; recorded spans are kept
+     */
+    void stop();
+
+    /**
+     * @brief Check whether spans are being recorded
+     */
+    bool isRecording() const {
+        return recording.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Record a complete span on the calling thread
+     * @param name Span name
+     * @param category Span category
+     * @param start Start time
+     * @param seconds Duration
+     * @param args JSON object with extra values, or empty
+     */
+    void addSpan(const std::string& name, const std::string& category,
+                 std::chrono::steady_clock::time_point start, double seconds,
+                 const std::string& args = "");
+
+    /**
+     * @brief Discard all recorded spans
+     */
+    void clear();
+
+    /**
+     * @brief Write the recorded spans as a trace-event JSON file
+     * @param filename Name of the file to save to
+     */
+    void save(const std::string& filename) const;
+
+private:
+    struct Span {
+        std::string name;
+        std::string category;
+        std::string args;
+        double startMicros;
+        double durationMicros;
+        unsigned thread;
+    };
+
+    std::atomic<bool> recording;
+    std::chrono::steady_clock::time_point epoch;
+    mutable std::mutex mutex;
+    std::vector<Span> spans;
+
+    TraceRecorder();
+    TraceRecorder(const TraceRecorder&);
+    TraceRecorder& operator=(const TraceRecorder&);
+};
+
+/**
+ * @brief Read a cheap, monotonic tick counter (the TSC on x86)
+ */
+inline uint64_t readTicks() {
+#if defined(ODE_ENABLE_INSTRUMENTATION) && (defined(__x86_64__) || defined(__i386__))
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/**
+ * @class SolveInstrumentation
+ * @brief Counters and timers of one NumericalMethod
+ *
+ * RHS calls are counted in a plain member on the hot path and published
+ * to an atomic counter on every sampled step and at the end of the solve,
+ * so getRhsCalls() can be read from another thread while a solve runs.
+ */
+class SolveInstrumentation {
+public:
+    /**
+     * @brief Every SAMPLE_INTERVAL-th step is split into phases
+     */
+    static const unsigned SAMPLE_INTERVAL = 64;
+
+    SolveInstrumentation()
+        : pendingCalls(0), rhsCalls(0), stepCount(0), sampledSteps(0), tickOverhead(0) {
+        phaseTicks[0] = phaseTicks[1] = phaseTicks[2] = 0;
+    }
+
+    /**
+     * @brief Check whether instrumentation is compiled in
+     */
+    static bool enabled() {
+#ifdef ODE_ENABLE_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Start timing a solve and reset its counters
+     */
+    void beginSolve();
+
+    /**
+     * @brief Finish timing a solve and fill in the stats
+     * @param methodName Name used for the trace span
+     */
+    void endSolve(const std::string& methodName);
+
+    /**
+     * @brief Count one call of the differential function
+     */
+    void countCall() {
+#ifdef ODE_ENABLE_INSTRUMENTATION
+        ++pendingCalls;
+#endif
+    }
+
+    /**
+     * @brief Count calls made on behalf of this method elsewhere
+     */
+    void countCalls(long calls) {
+#ifdef ODE_ENABLE_INSTRUMENTATION
+        pendingCalls += calls;
+#else
+        (void)calls;
+#endif
+    }
+
+    /**
+     * @brief Count one recorded point
+     */
+    void countStep() {
+#ifdef ODE_ENABLE_INSTRUMENTATION
+        ++stepCount;
+#endif
+    }
+
+    /**
+     * @brief Decide whether the current step is split into phases
+     */
+    bool sampleStep() {
+#ifdef ODE_ENABLE_INSTRUMENTATION
+        if (stepCount % SAMPLE_INTERVAL != 0) {
+            return false;
+        }
+        ++sampledSteps;
+        rhsCalls.store(pendingCalls, std::memory_order_relaxed);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Charge ticks of a sampled step to a phase, less the cost of reading the ticks
+     */
+    void addPhaseTicks(SolvePhase phase, uint64_t ticks) {
+        phaseTicks[static_cast<int>(phase)] += (ticks > tickOverhead) ? ticks - tickOverhead : 0;
+    }
+
+    /**
+     * @brief Set the time of the last setParameters
+     */
+    void setSetupSeconds(double seconds) {
+        stats.setupSeconds = seconds;
+    }
+
+    /**
+     * @brief Set the time of the last export
+     */
+    void setExportSeconds(double seconds) {
+        stats.exportSeconds = seconds;
+    }
+
+    /**
+     * @brief Get the RHS calls so far; safe to call while a solve runs
+     */
+    long getRhsCalls() const {
+        return rhsCalls.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the stats of the last solve
+     */
+    const SolveStats& getStats() const {
+        return stats;
+    }
+
+private:
+    SolveStats stats;
+    long pendingCalls;
+    std::atomic<long> rhsCalls;
+    long stepCount;
+    long sampledSteps;
+    uint64_t phaseTicks[3];
+    uint64_t tickOverhead;      // Ticks between two back-to-back readTicks()
+    uint64_t startTicks;
+    std::chrono::steady_clock::time_point startTime;
+
+    SolveInstrumentation(const SolveInstrumentation&);
+    SolveInstrumentation& operator=(const SolveInstrumentation&);
+};
+
+/**
+ * @class PhaseSample
+ * @brief Splits one step into phases when the step is sampled
+ *
+ * Construct at the top of the loop body, call enter() as each phase
+ * starts; the time up to the next enter() or the end of the step is
+ * charged to that phase.
+ */
+class PhaseSample {
+public:
+    explicit PhaseSample(SolveInstrumentation& inst)
+        : owner(inst), active(inst.sampleStep()), phase(SolvePhase::None), last(0) {}
+
+    ~PhaseSample() {
+        enter(SolvePhase::None);
+    }
+
+    /**
+     * @brief Start a phase, ending the previous one
+     */
+    void enter(SolvePhase next) {
+#ifdef ODE_ENABLE_INSTRUMENTATION
+        if (!active) {
+            return;
+        }
+        uint64_t now = readTicks();
+        if (phase != SolvePhase::None) {
+            owner.addPhaseTicks(phase, now - last);
+        }
+        phase = next;
+        last = now;
+#else
+        (void)next;
+#endif
+    }
+
+private:
+    SolveInstrumentation& owner;
+    bool active;
+    SolvePhase phase;
+    uint64_t last;
+};
+
+/**
+ * @class ScopedPhaseTimer
+ * @brief Times a scope and stores the seconds through a setter, e.g. for setup or export
+ */
+class ScopedPhaseTimer {
+public:
+    typedef void (SolveInstrumentation::*Setter)(double);
+
+    ScopedPhaseTimer(SolveInstrumentation& inst, Setter setterFunc, const char* spanName)
+        : owner(inst), setter(setterFunc), name(spanName) {
+#ifdef ODE_ENABLE_INSTRUMENTATION
+        start = std::chrono::steady_clock::now();
+#endif
+    }
+
+    ~ScopedPhaseTimer() {
+#ifdef ODE_ENABLE_INSTRUMENTATION
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        (owner.*setter)(seconds);
+        if (TraceRecorder::instance().isRecording()) {
+            TraceRecorder::instance().addSpan(name, "phase", start, seconds);
+        }
+#endif
+    }
+
+private:
+    SolveInstrumentation& owner;
+    Setter setter;
+    const char* name;
+    std::chrono::steady_clock::time_point start;
+};
+
+/**
+ * @class CountingFunction
+ * @brief Forwards to a function and counts the calls
+ *
+ * Passed to the steppers in place of diffFunction; it inlines to a plain
+ * call when instrumentation is compiled out.
+ */
+template <typename Func>
+class CountingFunction {
+public:
+    CountingFunction(Func& func, SolveInstrumentation& inst) : f(func), owner(inst) {}
+
+    template <typename... Args>
+    auto operator()(Args&&... args) -> decltype(std::declval<Func&>()(std::forward<Args>(args)...)) {
+        owner.countCall();
+        return f(std::forward<Args>(args)...);
+    }
+
+private:
+    Func& f;
+    SolveInstrumentation& owner;
+};
+
+/**
+ * @brief Wrap a function in a CountingFunction
+ */
+template <typename Func>
+CountingFunction<Func> countCalls(Func& func, SolveInstrumentation& inst) {
+    return CountingFunction<Func>(func, inst);
+}
+
+#endif // INSTRUMENTATION_H
@@ -0,0 +1,312 @@
+/**
+ * @file Jet.h
+ * @brief Truncated Taylor series arithmetic for forward-mode automatic differentiation
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef JET_H
+#define JET_H
+
+#include <cmath>
+#include <algorithm>
+
+/**
+ * @class Jet
+ * @brief Taylor coefficients c[0] + c[1] t + ... + c[n-1] t^(n-1) of a function of t
+ *
+ * Arithmetic and the elementary functions apply the usual recurrences to
+ * the coefficients (Griewank & Walther, Evaluating Derivatives, ch. 13),
+ * so evaluating f on Jets gives the Taylor coefficients of f along a curve
+ * at O(n^2) cost per operation. A Jet of two coefficients is a dual number
+ * and gives f and its derivative.
+ *
+ * A double converts to a constant Jet of one coefficient, and the result
+ * of an operation has as many coefficients as its longest operand. A
+ * right-hand side written once as a template works on double and Jet:
+ *
+ *   struct Logistic {
+ *       template <typename T>
+ *       T operator()(const T& x, const T& y) const {
+ *           using std::exp;
+ *           return y * (1.0 - y) + exp(-x);
+ *       }
+ *   };
+ *
+ * Call the functions unqualified, with using-declarations for std::, so
+ * that the Jet overloads are found for Jets.
+ */
+class Jet {
+public:
+    /**
+     * @brief Highest degree, so a Jet holds at most MAX_DEGREE + 1 coefficients
+     */
+    static const int MAX_DEGREE = 40;
+
+    /**
+     * @brief Constant Jet
+     */
+    Jet(double value = 0.0) : n(1) {
+        c[0] = value;
+    }
+
+    Jet(const Jet& other) : n(other.n) {
+        std::copy(other.c, other.c + n, c);
+    }
+
+    Jet& operator=(const Jet& other) {
+        n = other.n;
+        std::copy(other.c, other.c + n, c);
+        return *this;
+    }
+
+    /**
+     * @brief The independent variable value + t, with the given number of coefficients
+     */
+    static Jet variable(double value, int size) {
+        Jet jet;
+        jet.resize(size);
+        jet.c[0] = value;
+        if (size > 1) {
+            jet.c[1] = 1.0;
+        }
+        return jet;
+    }
+
+    /**
+     * @brief Get the number of coefficients
+     */
+    int size() const {
+        return n;
+    }
+
+    /**
+     * @brief Change the number of coefficients; new ones are zero
+     * @param size Between 1 and MAX_DEGREE + 1
+     */
+    void resize(int size) {
+        std::fill(c + std::min(n, size), c + size, 0.0);
+        n = size;
+    }
+
+    /**
+     * @brief Get coefficient k, 0 beyond the last one
+     */
+    double operator[](int k) const {
+        return k < n ? c[k] : 0.0;
+    }
+
+    /**
+     * @brief Get a reference to coefficient k, which must be below size()
+     */
+    double& operator[](int k) {
+        return c[k];
+    }
+
+    /**
+     * @brief Get the value, the coefficient of t^0
+     */
+    double value() const {
+        return c[0];
+    }
+
+    Jet& operator+=(const Jet& other) {
+        if (other.n > n) {
+            resize(other.n);
+        }
+        for (int k = 0; k < other.n; ++k) {
+            c[k] += other.c[k];
+        }
+        return *this;
+    }
+
+    Jet& operator-=(const Jet& other) {
+        if (other.n > n) {
+            resize(other.n);
+        }
+        for (int k = 0; k < other.n; ++k) {
+            c[k] -= other.c[k];
+        }
+        return *this;
+    }
+
+    Jet& operator*=(const Jet& other) {
+        return *this = *this * other;
+    }
+
+    Jet& operator/=(const Jet& other) {
+        return *this = *this / other;
+    }
+
+    friend Jet operator-(const Jet& u) {
+        Jet result;
+        result.n = u.n;
+        for (int k = 0; k < u.n; ++k) {
+            result.c[k] = -u.c[k];
+        }
+        return result;
+    }
+
+    friend Jet operator+(const Jet& u, const Jet& v) {
+        Jet result(u);
+        result += v;
+        return result;
+    }
+
+    friend Jet operator-(const Jet& u, const Jet& v) {
+        Jet result(u);
+        result -= v;
+        return result;
+    }
+
+    // c_k = sum u_j v_(k-j)
+    friend Jet operator*(const Jet& u, const Jet& v) {
+        Jet result;
+        result.n = std::max(u.n, v.n);
+        for (int k = 0; k < result.n; ++k) {
+            double sum = 0.0;
+            for (int j = std::max(0, k - v.n + 1); j <= std::min(k, u.n - 1); ++j) {
+                sum += u.c[j] * v.c[k - j];
+            }
+            result.c[k] = sum;
+        }
+        return result;
+    }
+
+    // c_k = (u_k - sum_(j >= 1) v_j c_(k-j)) / v_0
+    friend Jet operator/(const Jet& u, const Jet& v) {
+        Jet result;
+        result.n = std::max(u.n, v.n);
+        for (int k = 0; k < result.n; ++k) {
+            double sum = u[k];
+            for (int j = 1; j <= std::min(k, v.n - 1); ++j) {
+                sum -= v.c[j] * result.c[k - j];
+            }
+            result.c[k] = sum / v.c[0];
+        }
+        return result;
+    }
+
+    // c_k = sum u_j u_(k-j), using the symmetry of the terms
+    friend Jet square(const Jet& u) {
+        Jet result;
+        result.n = u.n;
+        for (int k = 0; k < u.n; ++k) {
+            double sum = 0.0;
+            for (int j = 0; j < (k + 1) / 2; ++j) {
+                sum += u.c[j] * u.c[k - j];
+            }
+            sum *= 2.0;
+            if (k % 2 == 0) {
+                sum += u.c[k / 2] * u.c[k / 2];
+            }
+            result.c[k] = sum;
+        }
+        return result;
+    }
+
+    // c' = u' c: c_k = (1/k) sum_(j >= 1) j u_j c_(k-j)
+    friend Jet exp(const Jet& u) {
+        Jet result;
+        result.n = u.n;
+        result.c[0] = std::exp(u.c[0]);
+        for (int k = 1; k < u.n; ++k) {
+            double sum = 0.0;
+            for (int j = 1; j <= k; ++j) {
+                sum += j * u.c[j] * result.c[k - j];
+            }
+            result.c[k] = sum / k;
+        }
+        return result;
+    }
+
+    // u c' = u': c_k = (u_k - (1/k) sum_(1 <= j < k) j c_j u_(k-j)) / u_0
+    friend Jet log(const Jet& u) {
+        Jet result;
+        result.n = u.n;
+        result.c[0] = std::log(u.c[0]);
+        for (int k = 1; k < u.n; ++k) {
+            double sum = 0.0;
+            for (int j = 1; j < k; ++j) {
+                sum += j * result.c[j] * u.c[k - j];
+            }
+            result.c[k] = (u.c[k] - sum / k) / u.c[0];
+        }
+        return result;
+    }
+
+    // c^2 = u: c_k = (u_k - sum_(1 <= j < k) c_j c_(k-j)) / (2 c_0)
+    friend Jet sqrt(const Jet& u) {
+        Jet result;
+        result.n = u.n;
+        result.c[0] = std::sqrt(u.c[0]);
+        for (int k = 1; k < u.n; ++k) {
+            double sum = 0.0;
+            for (int j = 1; j < k; ++j) {
+                sum += result.c[j] * result.c[k - j];
+            }
+            result.c[k] = (u.c[k] - sum) / (2.0 * result.c[0]);
+        }
+        return result;
+    }
+
+    // u c' = p u' c: c_k = (1 / (k u_0)) sum_(j >= 1) ((p + 1) j - k) u_j c_(k-j)
+    friend Jet pow(const Jet& u, double p) {
+        Jet result;
+        result.n = u.n;
+        result.c[0] = std::pow(u.c[0], p);
+        for (int k = 1; k < u.n; ++k) {
+            double sum = 0.0;
+            for (int j = 1; j <= k; ++j) {
+                sum += ((p + 1.0) * j - k) * u.c[j] * result.c[k - j];
+            }
+            result.c[k] = sum / (k * u.c[0]);
+        }
+        return result;
+    }
+
+    friend Jet sin(const Jet& u) {
+        Jet s;
+        Jet c;
+        sinCos(u, s, c);
+        return s;
+    }
+
+    friend Jet cos(const Jet& u) {
+        Jet s;
+        Jet c;
+        sinCos(u, s, c);
+        return c;
+    }
+
+    // s' = u' c and c' = -u' s, computed together
+    friend void sinCos(const Jet& u, Jet& s, Jet& c) {
+        s.n = u.n;
+        c.n = u.n;
+        s.c[0] = std::sin(u.c[0]);
+        c.c[0] = std::cos(u.c[0]);
+        for (int k = 1; k < u.n; ++k) {
+            double sinSum = 0.0;
+            double cosSum = 0.0;
+            for (int j = 1; j <= k; ++j) {
+                sinSum += j * u.c[j] * c.c[k - j];
+                cosSum += j * u.c[j] * s.c[k - j];
+            }
+            s.c[k] = sinSum / k;
+            c.c[k] = -cosSum / k;
+        }
+    }
+
+private:
+    int n;                          // Coefficients in use
+    double c[MAX_DEGREE + 1];       // Coefficients; those from n on are undefined
+};
+
+/**
+ * @brief x * x for doubles, so templated right-hand sides can call square() on both types
+ */
+inline double square(double x) {
+    return x * x;
+}
+
+#endif // JET_H
@@ -27,6 +27,11 @@ public:
      */
     void solve() override;
     
+    /**
+     * @brief Solve a system of ODEs using Modified Euler's method
+     */
+    void solveSystem() override;
+    
     /**
      * @brief Get the method name
      * @return String "Modified Euler's Method"
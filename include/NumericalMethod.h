@@ -11,6 +11,13 @@
 #include <vector>
 #include <string>
 #include <functional>
+#include <memory>
+#include "StepObserver.h"
+#include "Instrumentation.h"
+#include "TracePipeline.h"
+#include "Workspace.h"
+#include <ostream>
+#include <fstream>
 
 /**
  * @brief Default differential equation function: dy/dx = f(x,y)
@@ -27,6 +34,14 @@ double differentialFunction(double x, double y);
  */
 double exactSolution(double x);
 
+/**
+ * @brief Right-hand side of a system of ODEs: dy/dx = F(x, y)
+ *
+ * The callee writes all components of F(x, y) into dydx. Both buffers hold
+ * one value per component and never alias.
+ */
+typedef std::function<void(double x, const double* y, double* dydx)> SystemFunction;
+
 /**
  * @class NumericalMethod
  * @brief Abstract base class for all numerical methods
@@ -43,10 +58,166 @@ protected:
     // Function pointer to the differential equation
     std::function<double(double, double)> diffFunction;
     
+    // Exact solution the results are compared with; exactSolution by default
+    std::function<double(double)> exactFunction;
+    
+    // Right-hand side used when solving a system of equations
+    SystemFunction systemFunction;
+    size_t dimension;   // Number of components in the state (0 = scalar problem)
+    
     // Store results for analysis and visualization
     std::vector<double> xValues;
     std::vector<double> yValues;
     
+    // System results: one contiguous row of `dimension` values per step
+    std::vector<double> initialState;
+    std::vector<double> stateValues;
+    
+    // Optional sink receiving the steps instead of the vectors above
+    std::shared_ptr<StepObserver> observer;
+    bool hasResult;         // True once a step has been recorded
+    double lastX, lastY;    // Most recent point, kept even when streaming
+    std::vector<double> lastState;
+    
+    // Interpolation data of each step, recorded when dense output is on
+    bool denseOutput;
+    size_t denseStride;     // Values recorded per step (0 = no own interpolant)
+    std::vector<double> denseValues;
+    
+    // Counters and timers; mutable so the const exporters can be timed
+    mutable SolveInstrumentation instrumentation;
+    
+    // Scratch buffers of the solves; our own unless one is attached
+    Workspace ownWorkspace;
+    Workspace* workspace;
+    
+    // getMethodName(), built once so solves do not allocate it
+    mutable std::string cachedName;
+    
+    // Verbose output: header and summary go to the stream directly, the
+    // steps through a pipeline formatted on a background thread
+    std::unique_ptr<std::ofstream> traceFile;
+    std::ostream* traceOutput;
+    int traceDelay;         // Milliseconds after each step, -1 for the default
+    std::unique_ptr<TracePipeline> tracePipeline;
+    
+    /**
+     * @brief Interpolate y inside step i, between xValues[i] and xValues[i + 1]
+     *
+     * The default is a cubic Hermite interpolant through both end points and
+     * their slopes. Methods that record their own interpolation data in
+     * denseValues override this.
+     *
+     * @param i Index of the step
+     * @param theta Position inside the step, from 0 to 1
+     * @return Interpolated y value
+     */
+    virtual double interpolateStep(size_t i, double theta) const;
+    
+    /**
+     * @brief Compute out = y + a * k for every component of the state
+     */
+    static void addScaled(size_t n, const double* y, double a, const double* k, double* out) {
+        for (size_t j = 0; j < n; ++j) {
+            out[j] = y[j] + a * k[j];
+        }
+    }
+    
+    /**
+     * @brief Evaluate the system function, or diffFunction on y[0] for a single equation
+     */
+    void evaluateRhs(bool system, double x, const double* y, double* dydx) const {
+        if (system) {
+            systemFunction(x, y, dydx);
+        }
+        else {
+            dydx[0] = diffFunction(x, y[0]);
+        }
+    }
+    
+    /**
+     * @brief Emit the initial point and start the timers; called at the start of every solve
+     */
+    void beginSolve();
+    
+    /**
+     * @brief Stop the timers and notify the observer that the solve is complete
+     */
+    void endSolve();
+    
+    /**
+     * @brief Get the workspace for the buffers of one solve, emptied
+     */
+    Workspace& solveWorkspace() {
+        workspace->clear();
+        return *workspace;
+    }
+    
+    /**
+     * @brief Get the method name without building a new string
+     */
+    const std::string& cachedMethodName() const;
+    
+    /**
+     * @brief Get the stream verbose output is written to
+     */
+    std::ostream& traceStream() {
+        return *traceOutput;
+    }
+    
+    /**
+     * @brief Start formatting traced steps; call after writing the header
+     * @param formatter Formatter of the method
+     */
+    void beginTrace(StepFormatter formatter);
+    
+    /**
+     * @brief Queue one step for the verbose output
+     */
+    void traceStep(StepRecord record) {
+        if (compareExact) {
+            record.exact = exactFunction(record.x);
+        }
+        tracePipeline->push(record);
+    }
+    
+    /**
+     * @brief Wait until every traced step is written; call before writing the summary
+     */
+    void endTrace();
+    
+    /**
+     * @brief Record one step, in the vectors or through the observer
+     */
+    void recordStep(double x, double y) {
+        instrumentation.countStep();
+        lastX = x;
+        lastY = y;
+        hasResult = true;
+        if (observer) {
+            observer->observe(x, &y, 1);
+        }
+        else {
+            xValues.push_back(x);
+            yValues.push_back(y);
+        }
+    }
+    
+    /**
+     * @brief Record one state row, in the vectors or through the observer
+     */
+    void storeState(double x, const double* y);
+    
+    /**
+     * @brief Throw unless system parameters and the system function are set
+     */
+    void checkSystemReady() const;
+    
+    /**
+     * @brief Print the final state of a system solve when verbose is on
+     */
+    void printSystemSummary() const;
+    
 public:
     /**
      * @brief Constructor
@@ -68,18 +239,92 @@ public:
      */
     void setParameters(double x0Val, double y0Val, double xTargetVal, double stepSizeVal);
     
+    /**
+     * @brief Set the initial state and parameters for a system of ODEs
+     * @param x0Val Initial x value
+     * @param y0Val Initial state vector (its size fixes the dimension)
+     * @param xTargetVal Target x value
+     * @param stepSizeVal Step size h
+     */
+    void setParameters(double x0Val, const std::vector<double>& y0Val, double xTargetVal, double stepSizeVal);
+    
+    /**
+     * @brief Discard the results of the last solve, keeping the allocated memory
+     *
+     * setParameters() calls this, so solving the same object again reuses
+     * its vectors and workspace instead of growing them; once they are
+     * large enough a solve allocates no heap memory.
+     */
+    void reset();
+    
+    /**
+     * @brief Take the scratch buffers of solveSystem() from an outside workspace
+     *
+     * The workspace must outlive the solves and must not be used by two
+     * solves at the same time.
+     *
+     * @param ws Workspace to use, or nullptr for the method's own
+     */
+    void setWorkspace(Workspace* ws);
+    
+    /**
+     * @brief Set the right-hand side used by solveSystem()
+     * @param sysFunc Function writing F(x, y) into a caller-provided buffer
+     */
+    void setSystemFunction(SystemFunction sysFunc);
+    
+    /**
+     * @brief Stream steps to a sink instead of storing them in memory
+     *
+     * Set the observer before setParameters(). With an observer the x and y
+     * vectors stay empty; getResult() and calculateError() still report the
+     * final point. Pass nullptr to go back to in-memory storage.
+     *
+     * @param obs Sink receiving the initial point and every step
+     */
+    void setObserver(std::shared_ptr<StepObserver> obs);
+    
     /**
      * @brief Enable/disable verbose output
      * @param isVerbose True for detailed output, false for minimal output
      */
     void setVerbose(bool isVerbose);
     
+    /**
+     * @brief Write verbose output to a file instead of the console
+     * @param filename Name of the file, or empty for the console
+     */
+    void setTraceFile(const std::string& filename);
+    
+    /**
+     * @brief Set the pause after each verbose step
+     *
+     * The pause is taken by the thread formatting the steps, never by the
+     * solver. The default is 100 ms on the console and none for a file.
+     *
+     * @param millis Milliseconds, or -1 for the default
+     */
+    void setTraceDelay(int millis);
+    
     /**
      * @brief Enable/disable comparison with exact solution
      * @param doCompare True to compare with exact solution
      */
     void setCompareExact(bool doCompare);
     
+    /**
+     * @brief Set the exact solution used for comparisons and errors
+     * @param exact Exact solution y(x); empty for the default exactSolution
+     */
+    void setExactSolution(std::function<double(double)> exact);
+    
+    /**
+     * @brief Evaluate the exact solution used for comparisons
+     * @param x Independent variable value
+     * @return Exact solution at x
+     */
+    double exactAt(double x) const;
+    
     /**
      * @brief Get the result at the target x
      * @return Approximated y value at target x
@@ -98,12 +343,110 @@ public:
      */
     const std::vector<double>& getYValues() const;
     
+    /**
+     * @brief Get the number of components of a system solve
+     * @return Dimension of the state, 0 for scalar problems
+     */
+    size_t getDimension() const;
+    
+    /**
+     * @brief Get all system states, stored row by row
+     * @return Vector of (steps + 1) * dimension values
+     */
+    const std::vector<double>& getStateValues() const;
+    
+    /**
+     * @brief Get the state at a given step of a system solve
+     * @param step Index of the step (0 is the initial state)
+     * @return Pointer to `dimension` contiguous values
+     */
+    const double* getState(size_t step) const;
+    
+    /**
+     * @brief Get the state at the target x of a system solve
+     * @return Approximated state vector at target x
+     */
+    std::vector<double> getStateResult() const;
+    
+    /**
+     * @brief Get the call counts and phase times of the last solve
+     *
+     * All values are zero unless the solver was built with
+     * ODE_ENABLE_INSTRUMENTATION.
+     *
+     * @return Stats of the last setParameters, solve and export
+     */
+    const SolveStats& getSolveStats() const;
+    
+    /**
+     * @brief Get the differential-function calls of the running or last solve
+     *
+     * Safe to call from another thread while solve() runs; the count is
+     * updated every SolveInstrumentation::SAMPLE_INTERVAL steps.
+     *
+     * @return Calls so far
+     */
+    long getRhsCallCount() const;
+    
+    /**
+     * @brief Record the interpolation data of each step during solve()
+     *
+     * Methods with their own continuous extension (RK4, Dormand-Prince) use
+     * it for evaluateAt(); all others use cubic Hermite interpolation, which
+     * needs no extra storage.
+     *
+     * @param enable True to record dense output
+     */
+    void setDenseOutput(bool enable);
+    
+    /**
+     * @brief Evaluate the solution at any x between x0 and the last step
+     *
+     * Locates the step by binary search and interpolates inside it, so
+     * queries never re-integrate the equation.
+     *
+     * @param x Query point
+     * @return Interpolated y value
+     */
+    double evaluateAt(double x) const;
+    
+    /**
+     * @brief Evaluate the solution at many points
+     *
+     * Runs of query points in the direction of integration are answered
+     * with a forward scan, other points with binary search. Solves from
+     * xTarget < x0 are interpolated the same way.
+     *
+     * @param xs Query points
+     * @param count Number of query points
+     * @param out Receives one y value per query point
+     */
+    void evaluateAt(const double* xs, size_t count, double* out) const;
+    
+    /**
+     * @brief Evaluate the solution at many points
+     * @param xs Query points
+     * @return Interpolated y values, one per query point
+     */
+    std::vector<double> evaluateAt(const std::vector<double>& xs) const;
+    
     /**
      * @brief Save results to a CSV file
      * @param filename Name of the file to save to
      */
     void saveToCSV(const std::string& filename) const;
     
+    /**
+     * @brief Save results to a binary trajectory file (see TrajectoryFile.h)
+     *
+     * Each column is written with a single sequential write, and the file
+     * can be read back without parsing through TrajectoryFile.
+     *
+     * @param filename Name of the file to save to
+     * @param equationId Identifier of the equation, stored in the header
+     */
+    void saveToBinary(const std::string& filename, const std::string& equationId = "default") const;
+    
     /**
      * @brief Calculate global truncation error if exact solution is available
      * @return Maximum absolute error
@@ -115,6 +458,15 @@ public:
      */
     virtual void solve() = 0;
     
+    /**
+     * @brief Solve the system set with setParameters(x0, vector, ...)
+     *
+     * Systems are integrated in full precision; the 4-decimal rounding of
+     * the scalar solvers is not applied. The default implementation throws
+     * for methods without system support.
+     */
+    virtual void solveSystem();
+    
     /**
      * @brief Get the name of the method
      * @return String with the method name
@@ -0,0 +1,64 @@
+/**
+ * @file OdePlugin.h
+ * @brief C interface of right-hand side plugins loaded at run time
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * A plugin is a shared library exporting the functions below with C
+ * linkage. It may be written in C or C++ and needs nothing but this
+ * header. Only ode_plugin_abi_version and ode_plugin_rhs are required:
+ *
+ *   #include "OdePlugin.h"
+ *
+ *   ODE_PLUGIN_EXPORT int ode_plugin_abi_version(void) { return ODE_PLUGIN_ABI_VERSION; }
+ *   ODE_PLUGIN_EXPORT double ode_plugin_rhs(double x, double y) { return x * y; }
+ *
+ * See Plugin for loading a plugin.
+ */
+
+#ifndef ODE_PLUGIN_H
+#define ODE_PLUGIN_H
+
+#include <stddef.h>
+
+/**
+ * @brief Version of this interface; a plugin must return it from ode_plugin_abi_version
+ */
+#define ODE_PLUGIN_ABI_VERSION 1
+
+#ifdef _WIN32
+#define ODE_PLUGIN_EXPORT_ATTRIBUTE __declspec(dllexport)
+#else
+#define ODE_PLUGIN_EXPORT_ATTRIBUTE __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+#define ODE_PLUGIN_EXPORT extern "C" ODE_PLUGIN_EXPORT_ATTRIBUTE
+#else
+#define ODE_PLUGIN_EXPORT ODE_PLUGIN_EXPORT_ATTRIBUTE
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief ode_plugin_abi_version: interface version the plugin was built for (required) */
+typedef int (*OdePluginAbiVersion)(void);
+
+/** @brief ode_plugin_rhs: f(x, y) (required) */
+typedef double (*OdePluginRhs)(double x, double y);
+
+/** @brief ode_plugin_rhs_batch: dydx[i] = f(x[i], y[i]) for i < count (optional) */
+typedef void (*OdePluginBatchRhs)(size_t count, const double* x, const double* y, double* dydx);
+
+/** @brief ode_plugin_exact: exact solution y(x) (optional) */
+typedef double (*OdePluginExact)(double x);
+
+/** @brief ode_plugin_jacobian: df/dy at (x, y), used by the implicit methods (optional) */
+typedef double (*OdePluginJacobian)(double x, double y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ODE_PLUGIN_H */
@@ -0,0 +1,61 @@
+/**
+ * @file OdeSolver.h
+ * @brief Entry point for calling the solvers from another program
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Link against odesolver::odesolver (find_package(odesolver)) and call
+ * solveOde(). It never throws: every failure, including a throwing
+ * right-hand side, is returned in OdeSolution::error. Calls share no
+ * state, so they may run concurrently from any number of threads.
+ */
+
+#ifndef ODE_SOLVER_H
+#define ODE_SOLVER_H
+
+#include <vector>
+#include <string>
+#include <functional>
+
+/**
+ * @struct OdeProblem
+ * @brief Initial value problem dy/dx = f(x, y), y(x0) = y0, and how to solve it
+ */
+struct OdeProblem {
+    std::function<double(double, double)> rhs;     // f(x, y); empty for the built-in equation
+    double x0;
+    double y0;
+    double xTarget;
+    double stepSize;        // Step size, or initial step size of adaptive methods
+    std::string method;     // Short method name, see Utility::createMethod
+    bool keepTrajectory;    // False to return only the final point
+
+    OdeProblem()
+        : x0(0.0), y0(1.0), xTarget(1.0), stepSize(0.1), method("rk4"), keepTrajectory(true) {}
+};
+
+/**
+ * @struct OdeSolution
+ * @brief Result of solveOde()
+ */
+struct OdeSolution {
+    bool ok;                    // False if the solve failed
+    std::string error;          // Reason of the failure, empty on success
+    std::string methodName;     // Full name of the method
+    double finalX;              // Last x reached
+    double finalY;              // Approximated y at finalX
+    std::vector<double> x;      // Every step, if keepTrajectory
+    std::vector<double> y;
+    long rhsCalls;              // Calls of f; 0 unless built with ODE_ENABLE_INSTRUMENTATION
+
+    OdeSolution() : ok(false), finalX(0.0), finalY(0.0), rhsCalls(0) {}
+};
+
+/**
+ * @brief Solve an initial value problem
+ * @param problem Equation, parameters and method
+ * @return The solution, or ok == false and the reason in error
+ */
+OdeSolution solveOde(const OdeProblem& problem);
+
+#endif // ODE_SOLVER_H
@@ -0,0 +1,163 @@
+/**
+ * @file ParameterSweep.h
+ * @brief Solves one method over a grid of initial conditions, intervals and step sizes
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef PARAMETER_SWEEP_H
+#define PARAMETER_SWEEP_H
+
+#include "NumericalMethod.h"
+#include <vector>
+#include <string>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+
+class FinalValueObserver;
+
+/**
+ * @struct SweepGrid
+ * @brief Values of each parameter; the sweep covers their cartesian product
+ */
+struct SweepGrid {
+    std::vector<double> x0Values;
+    std::vector<double> y0Values;
+    std::vector<double> xTargetValues;
+    std::vector<double> stepSizes;
+
+    /**
+     * @brief Get the number of grid points
+     */
+    size_t size() const;
+
+    /**
+     * @brief Evenly spaced values from first to last inclusive
+     * @param first First value
+     * @param last Last value
+     * @param count Number of values
+     * @return The values
+     */
+    static std::vector<double> linspace(double first, double last, size_t count);
+};
+
+/**
+ * @struct SweepResult
+ * @brief Outcome of one grid point
+ */
+struct SweepResult {
+    double x0;
+    double y0;
+    double xTarget;
+    double stepSize;
+    double finalX;          // Last x reached
+    double finalY;          // Approximated y at finalX
+    double error;           // |exact - finalY|, NaN without an exact solution
+    std::string message;    // Empty on success, otherwise the exception text
+};
+
+/**
+ * @class ParameterSweep
+ * @brief Runs a method over every point of a SweepGrid on a work-stealing thread pool
+ *
+ * The grid is split into chunks of consecutive points and each chunk is a
+ * task. Step size is the fastest-varying parameter, so cheap and expensive
+ * points are mixed within a chunk, and idle workers steal whole chunks
+ * from busy ones. Tasks draw their method instance, with a
+ * FinalValueObserver so no trajectory is stored, from a pool kept across
+ * runs, so after the first run the solves allocate no memory.
+ */
+class ParameterSweep {
+public:
+    /**
+     * @brief Creates a new method instance; the sweep takes ownership
+     */
+    typedef std::function<NumericalMethod*()> MethodFactory;
+
+    /**
+     * @brief Exact solution y(x) of the problem started at (x0, y0)
+     */
+    typedef std::function<double(double x0, double y0, double x)> ExactFunction;
+
+    /**
+     * @brief Constructor
+     * @param factoryFunc Creates the method to sweep
+     * @param threadCount Number of worker threads, 0 for one per core
+     */
+    explicit ParameterSweep(MethodFactory factoryFunc, unsigned threadCount = 0);
+
+    /**
+     * @brief Set the grid to sweep
+     * @param gridVal Parameter values
+     */
+    void setGrid(const SweepGrid& gridVal);
+
+    /**
+     * @brief Set the exact solution used for the error of each point
+     * @param exactFunc Exact solution, or empty to leave the errors NaN
+     */
+    void setExactSolution(ExactFunction exactFunc);
+
+    /**
+     * @brief Set the number of grid points per task
+     * @param size Points per task, 0 to choose from the grid size and thread count
+     */
+    void setChunkSize(size_t size);
+
+    /**
+     * @brief Solve every grid point
+     *
+     * A point whose solve throws gets the exception text in its message;
+     * the other points are unaffected.
+     *
+     * @return Results in grid order (step size fastest, then xTarget, y0, x0)
+     */
+    const std::vector<SweepResult>& run();
+
+    /**
+     * @brief Get the results of the last run
+     */
+    const std::vector<SweepResult>& getResults() const;
+
+    /**
+     * @brief Get the wall time of the last run in seconds
+     */
+    double getWallTime() const;
+
+    /**
+     * @brief Get the number of chunks workers stole from each other in the last run
+     */
+    size_t getStealCount() const;
+
+    /**
+     * @brief Save the results of the last run to a CSV file
+     * @param filename Name of the file to save to
+     */
+    void saveToCSV(const std::string& filename) const;
+
+private:
+    MethodFactory factory;
+    ExactFunction exact;
+    unsigned threads;
+    size_t chunkSize;
+    SweepGrid grid;
+    std::vector<SweepResult> results;
+    double wallTime;
+    size_t stealCount;
+
+    // A method and its observer, reused by later chunks and runs
+    struct PooledMethod {
+        std::unique_ptr<NumericalMethod> method;
+        std::shared_ptr<FinalValueObserver> finalValue;
+    };
+    std::vector<PooledMethod> idleMethods;
+    std::mutex poolMutex;
+
+    PooledMethod takeMethod();
+    void returnMethod(PooledMethod& pooled);
+    void solveChunk(size_t begin, size_t end);
+};
+
+#endif // PARAMETER_SWEEP_H
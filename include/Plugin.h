@@ -0,0 +1,109 @@
+/**
+ * @file Plugin.h
+ * @brief Loads the right-hand side of an equation from a shared library
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef PLUGIN_H
+#define PLUGIN_H
+
+#include <string>
+#include "OdePlugin.h"
+#include "Ensemble.h"
+
+class NumericalMethod;
+
+/**
+ * @class Plugin
+ * @brief Shared library implementing the interface of OdePlugin.h
+ *
+ * The library is opened and every symbol looked up once, in the
+ * constructor. Methods then call the plugin through plain function
+ * pointers, as fast as a compiled-in differentialFunction.
+ *
+ * The library is closed by the destructor, so the Plugin must outlive
+ * every method and function obtained from it.
+ */
+class Plugin {
+public:
+    /**
+     * @brief Open a plugin
+     * @param path Path of the shared library; a name without a slash is searched for as dlopen does
+     */
+    explicit Plugin(const std::string& path);
+
+    /**
+     * @brief Destructor, closes the library
+     */
+    ~Plugin();
+
+    /**
+     * @brief Get the path the plugin was loaded from
+     */
+    const std::string& getPath() const;
+
+    /**
+     * @brief Get f(x, y)
+     */
+    OdePluginRhs getRhs() const;
+
+    /**
+     * @brief Get the batched f, or a loop over getRhs() if the plugin has none
+     */
+    BatchFunction getBatchRhs() const;
+
+    /**
+     * @brief True if the plugin exports its exact solution
+     */
+    bool hasExactSolution() const;
+
+    /**
+     * @brief Get the exact solution, NULL if the plugin has none
+     */
+    OdePluginExact getExactSolution() const;
+
+    /**
+     * @brief True if the plugin exports df/dy
+     */
+    bool hasJacobian() const;
+
+    /**
+     * @brief Get df/dy, NULL if the plugin has none
+     */
+    OdePluginJacobian getJacobian() const;
+
+    /**
+     * @brief Create a method solving the equation of the plugin
+     *
+     * The method also gets the exact solution and, if it is implicit, the
+     * Jacobian of the plugin when these are exported.
+     *
+     * @param name Short name of the method, see Utility::createMethod
+     * @return New method; the caller takes ownership
+     */
+    NumericalMethod* createMethod(const std::string& name) const;
+
+private:
+    std::string path;
+    void* handle;
+    OdePluginRhs rhs;
+    OdePluginBatchRhs batchRhs;
+    OdePluginExact exact;
+    OdePluginJacobian jacobian;
+
+    /**
+     * @brief Look up a symbol of the library, NULL if it is missing
+     */
+    void* lookup(const char* symbol) const;
+
+    /**
+     * @brief Close the library
+     */
+    void close();
+
+    Plugin(const Plugin&);
+    Plugin& operator=(const Plugin&);
+};
+
+#endif // PLUGIN_H
@@ -0,0 +1,67 @@
+/**
+ * @file PrecisionPolicy.h
+ * @brief Compile-time choice between 4-decimal and full-precision stepping
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef PRECISION_POLICY_H
+#define PRECISION_POLICY_H
+
+#include <cmath>
+
+/**
+ * @struct ClassroomPrecision
+ * @brief Rounds the state to 4 decimal places after every step, as done by hand
+ *
+ * Reproduces the worked examples exactly, but the rounding error soon
+ * dominates the truncation error of the higher order methods.
+ */
+struct ClassroomPrecision {
+    static const bool rounds = true;
+
+    static double apply(double value) {
+        return std::round(value * 10000.0) / 10000.0;
+    }
+
+    static const char* name() {
+        return "classroom (4 decimal places)";
+    }
+};
+
+/**
+ * @struct FullPrecision
+ * @brief Keeps the state in full double precision
+ */
+struct FullPrecision {
+    static const bool rounds = false;
+
+    static double apply(double value) {
+        return value;
+    }
+
+    static const char* name() {
+        return "full";
+    }
+};
+
+/**
+ * @brief Policy applied to the state by the solvers
+ *
+ * Classroom precision unless ODE_FULL_PRECISION is defined (the
+ * PRECISION=full CMake option).
+ */
+#ifdef ODE_FULL_PRECISION
+typedef FullPrecision PrecisionPolicy;
+#else
+typedef ClassroomPrecision PrecisionPolicy;
+#endif
+
+/**
+ * @brief Round a value to 4 decimal places for printing
+ */
+inline double roundForDisplay(double value) {
+    return std::round(value * 10000.0) / 10000.0;
+}
+
+#endif // PRECISION_POLICY_H
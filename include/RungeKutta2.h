@@ -27,6 +27,11 @@ public:
      */
     void solve() override;
     
+    /**
+     * @brief Solve a system of ODEs using 2nd order Runge-Kutta method
+     */
+    void solveSystem() override;
+    
     /**
      * @brief Get the method name
      * @return String "2nd Order Runge-Kutta Method"
@@ -27,11 +27,22 @@ public:
      */
     void solve() override;
     
+    /**
+     * @brief Solve a system of ODEs using 4th order Runge-Kutta method
+     */
+    void solveSystem() override;
+    
     /**
      * @brief Get the method name
      * @return String "4th Order Runge-Kutta Method"
      */
     std::string getMethodName() const override;
+    
+protected:
+    /**
+     * @brief Interpolate inside step i with the method's continuous extension
+     */
+    double interpolateStep(size_t i, double theta) const override;
 };
 
 #endif // RUNGE_KUTTA4_H
\ No newline at end of file
@@ -0,0 +1,98 @@
+/**
+ * @file SpscRingBuffer.h
+ * @brief Lock-free ring buffer for one producer and one consumer thread
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef SPSC_RING_BUFFER_H
+#define SPSC_RING_BUFFER_H
+
+#include <vector>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @class SpscRingBuffer
+ * @brief Bounded FIFO queue safe for exactly one pushing and one popping thread
+ *
+ * The capacity is rounded up to a power of two. Head and tail only grow,
+ * each is written by one side, and the acquire/release pairs make the
+ * slot contents visible before the index that publishes them.
+ */
+template <typename T>
+class SpscRingBuffer {
+public:
+    /**
+     * @brief Constructor
+     * @param minCapacity Smallest number of elements the buffer must hold
+     */
+    explicit SpscRingBuffer(size_t minCapacity) : head(0), tail(0) {
+        size_t capacity = 1;
+        while (capacity < minCapacity) {
+            capacity <<= 1;
+        }
+        slots.resize(capacity);
+        mask = capacity - 1;
+    }
+
+    /**
+     * @brief Append an element; producer thread only
+     * @return False if the buffer is full
+     */
+    bool tryPush(const T& value) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) > mask) {
+            return false;
+        }
+        slots[t & mask] = value;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest element; consumer thread only
+     * @return False if the buffer is empty
+     */
+    bool tryPop(T& value) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = slots[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Check whether the buffer is empty; exact only on the consumer thread
+     */
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get the number of queued elements; exact only on either of the two threads
+     */
+    size_t size() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get the number of elements the buffer holds
+     */
+    size_t capacity() const {
+        return slots.size();
+    }
+
+private:
+    std::vector<T> slots;
+    size_t mask;
+
+    // Padded apart so the two threads do not write to the same cache line
+    std::atomic<size_t> head;
+    char padding[64];
+    std::atomic<size_t> tail;
+};
+
+#endif // SPSC_RING_BUFFER_H
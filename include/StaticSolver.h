@@ -0,0 +1,221 @@
+/**
+ * @file StaticSolver.h
+ * @brief Header-only solvers templated on the type of the right-hand side
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * The classes derived from NumericalMethod call the differential equation
+ * through std::function, which the compiler cannot see through. The
+ * steppers below take the callable as a template parameter instead, so a
+ * lambda or functor is inlined into the stepping loop. The virtual solvers
+ * instantiate the same steppers with std::function and add printing,
+ * rounding and result storage on top.
+ */
+
+#ifndef STATIC_SOLVER_H
+#define STATIC_SOLVER_H
+
+#include <vector>
+
+/**
+ * @struct EulerStepper
+ * @brief One step of Euler's method
+ *
+ * Every stepper fills k with the stage values of its scheme and returns the
+ * increment to add to y.
+ */
+struct EulerStepper {
+    static const int stages = 1;
+
+    template <typename Func>
+    static double step(Func& f, double x, double y, double h, double* k) {
+        // k[0] = f(x_n, y_n)
+        k[0] = f(x, y);
+        return h * k[0];
+    }
+};
+
+/**
+ * @struct ModifiedEulerStepper
+ * @brief One predictor-corrector step of Modified Euler's method
+ */
+struct ModifiedEulerStepper {
+    static const int stages = 2;
+
+    template <typename Func>
+    static double step(Func& f, double x, double y, double h, double* k) {
+        // k[0] = f(x_n, y_n), k[1] = f(x_n + h, y*) with the Euler predictor y*
+        k[0] = f(x, y);
+        k[1] = f(x + h, y + h * k[0]);
+        return h * 0.5 * (k[0] + k[1]);
+    }
+};
+
+/**
+ * @struct RungeKutta2Stepper
+ * @brief One step of the 2nd order Runge-Kutta method
+ */
+struct RungeKutta2Stepper {
+    static const int stages = 2;
+
+    template <typename Func>
+    static double step(Func& f, double x, double y, double h, double* k) {
+        // k1 = h * f(x, y), k2 = h * f(x + h, y + k1)
+        k[0] = h * f(x, y);
+        k[1] = h * f(x + h, y + k[0]);
+        return 0.5 * (k[0] + k[1]);
+    }
+};
+
+/**
+ * @struct RungeKutta4Stepper
+ * @brief One step of the 4th order Runge-Kutta method
+ */
+struct RungeKutta4Stepper {
+    static const int stages = 4;
+
+    template <typename Func>
+    static double step(Func& f, double x, double y, double h, double* k) {
+        k[0] = h * f(x, y);
+        k[1] = h * f(x + 0.5 * h, y + 0.5 * k[0]);
+        k[2] = h * f(x + 0.5 * h, y + 0.5 * k[1]);
+        k[3] = h * f(x + h, y + k[2]);
+        return (k[0] + 2.0 * k[1] + 2.0 * k[2] + k[3]) / 6.0;
+    }
+};
+
+/**
+ * @brief Increment of the 4-step Adams-Bashforth formula
+ * @param h Step size
+ * @param f Slopes f_{n-3}, f_{n-2}, f_{n-1}, f_n
+ * @return Value to add to y_n
+ */
+inline double adamsBashforth4Increment(double h, const double* f) {
+    return h * (
+        55.0 * f[3] -
+        59.0 * f[2] +
+        37.0 * f[1] -
+        9.0 * f[0]
+    ) / 24.0;
+}
+
+/**
+ * @class StaticSolver
+ * @brief Fixed-step solver for any one-step stepper and callable
+ *
+ * Results are kept in full precision.
+ */
+template <typename Stepper, typename Func>
+class StaticSolver {
+public:
+    /**
+     * @brief Constructor
+     * @param func Callable representing the differential equation
+     */
+    explicit StaticSolver(Func func) : f(func) {}
+
+    /**
+     * @brief Integrate from (x0, y0) to xTarget without storing the trajectory
+     * @return Approximated y value at xTarget
+     */
+    double solve(double x0, double y0, double xTarget, double h) {
+        int steps = static_cast<int>((xTarget - x0) / h + 0.5);
+        double k[Stepper::stages];
+        double x = x0;
+        double y = y0;
+
+        for (int i = 0; i < steps; ++i) {
+            y += Stepper::step(f, x, y, h, k);
+            x += h;
+        }
+        return y;
+    }
+
+    /**
+     * @brief Integrate from (x0, y0) to xTarget and append every step to xs and ys
+     * @return Approximated y value at xTarget
+     */
+    double solve(double x0, double y0, double xTarget, double h,
+                 std::vector<double>& xs, std::vector<double>& ys) {
+        int steps = static_cast<int>((xTarget - x0) / h + 0.5);
+        double k[Stepper::stages];
+        double x = x0;
+        double y = y0;
+
+        xs.reserve(xs.size() + steps + 1);
+        ys.reserve(ys.size() + steps + 1);
+        xs.push_back(x);
+        ys.push_back(y);
+
+        for (int i = 0; i < steps; ++i) {
+            y += Stepper::step(f, x, y, h, k);
+            x += h;
+            xs.push_back(x);
+            ys.push_back(y);
+        }
+        return y;
+    }
+
+private:
+    Func f;
+};
+
+/**
+ * @class StaticAdamsBashforth
+ * @brief 4-step Adams-Bashforth solver started with RK4, for any callable
+ */
+template <typename Func>
+class StaticAdamsBashforth {
+public:
+    /**
+     * @brief Constructor
+     * @param func Callable representing the differential equation
+     */
+    explicit StaticAdamsBashforth(Func func) : f(func) {}
+
+    /**
+     * @brief Integrate from (x0, y0) to xTarget without storing the trajectory
+     * @return Approximated y value at xTarget
+     */
+    double solve(double x0, double y0, double xTarget, double h) {
+        int steps = static_cast<int>((xTarget - x0) / h + 0.5);
+        double k[RungeKutta4Stepper::stages];
+        double fValues[4];
+        double x = x0;
+        double y = y0;
+
+        // RK4 for the first 3 steps
+        fValues[0] = f(x, y);
+        for (int i = 1; i < 4; ++i) {
+            y += RungeKutta4Stepper::step(f, x, y, h, k);
+            x += h;
+            fValues[i] = f(x, y);
+        }
+
+        for (int i = 4; i <= steps; ++i) {
+            y += adamsBashforth4Increment(h, fValues);
+            x += h;
+
+            fValues[0] = fValues[1];
+            fValues[1] = fValues[2];
+            fValues[2] = fValues[3];
+            fValues[3] = f(x, y);
+        }
+        return y;
+    }
+
+private:
+    Func f;
+};
+
+/**
+ * @brief Create a StaticSolver, deducing the type of the callable
+ *
+ * Example: makeStaticSolver<RungeKutta4Stepper>([](double x, double y) { return x + y; })
+ */
+template <typename Stepper, typename Func>
+StaticSolver<Stepper, Func> makeStaticSolver(Func func) {
+    return StaticSolver<Stepper, Func>(func);
+}
+
+#endif // STATIC_SOLVER_H
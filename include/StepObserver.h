@@ -0,0 +1,192 @@
+/**
+ * @file StepObserver.h
+ * @brief Sinks receiving the steps of a solve as they are computed
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef STEP_OBSERVER_H
+#define STEP_OBSERVER_H
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <cstddef>
+#include <cstdio>
+
+/**
+ * @class StepObserver
+ * @brief Interface for sinks that receive every step of a solve
+ *
+ * When a NumericalMethod has an observer, steps are streamed to it instead
+ * of being appended to the in-memory trajectory, so memory use no longer
+ * grows with the number of steps.
+ */
+class StepObserver {
+public:
+    /**
+     * @brief Virtual destructor
+     */
+    virtual ~StepObserver() {}
+
+    /**
+     * @brief Called once before the initial point
+     * @param methodName Name of the method being solved
+     * @param expectedSteps Number of steps, or -1 for adaptive methods
+     */
+    virtual void begin(const std::string& methodName, long expectedSteps) {
+        (void)methodName;
+        (void)expectedSteps;
+    }
+
+    /**
+     * @brief Called for the initial point and after every step
+     * @param x Current x value
+     * @param y Current state, `n` values (1 for scalar problems)
+     * @param n Number of components in the state
+     */
+    virtual void observe(double x, const double* y, size_t n) = 0;
+
+    /**
+     * @brief Called once after the last step
+     */
+    virtual void end() {}
+};
+
+/**
+ * @class FinalValueObserver
+ * @brief Keeps only the last point; the cheapest sink
+ */
+class FinalValueObserver : public StepObserver {
+public:
+    FinalValueObserver();
+
+    void observe(double x, const double* y, size_t n) override;
+
+    /**
+     * @brief Get the last observed x value
+     */
+    double getX() const;
+
+    /**
+     * @brief Get the last observed state
+     */
+    const std::vector<double>& getState() const;
+
+private:
+    double lastX;
+    std::vector<double> lastState;
+};
+
+/**
+ * @class VectorObserver
+ * @brief Stores the whole trajectory in memory, like the default behaviour
+ */
+class VectorObserver : public StepObserver {
+public:
+    void begin(const std::string& methodName, long expectedSteps) override;
+    void observe(double x, const double* y, size_t n) override;
+
+    /**
+     * @brief Get all x values
+     */
+    const std::vector<double>& getXValues() const;
+
+    /**
+     * @brief Get all states, stored row by row
+     */
+    const std::vector<double>& getValues() const;
+
+private:
+    std::vector<double> xValues;
+    std::vector<double> values;
+};
+
+/**
+ * @class CallbackObserver
+ * @brief Forwards every point to a user-supplied function
+ */
+class CallbackObserver : public StepObserver {
+public:
+    typedef std::function<void(double x, const double* y, size_t n)> Callback;
+
+    /**
+     * @brief Constructor
+     * @param func Function called for every point
+     */
+    explicit CallbackObserver(Callback func);
+
+    void observe(double x, const double* y, size_t n) override;
+
+private:
+    Callback callback;
+};
+
+/**
+ * @class BufferedObserver
+ * @brief Collects points in a bounded buffer and hands them over in blocks
+ *
+ * The flush function receives the x values, the states (row by row), the
+ * number of points and the state dimension. It is called whenever the
+ * buffer is full and once at the end of the solve.
+ */
+class BufferedObserver : public StepObserver {
+public:
+    typedef std::function<void(const double* xs, const double* ys, size_t count, size_t n)> FlushFunction;
+
+    /**
+     * @brief Constructor
+     * @param capacityVal Number of points held before flushing
+     * @param flushFunc Function receiving each full block
+     */
+    BufferedObserver(size_t capacityVal, FlushFunction flushFunc);
+
+    void observe(double x, const double* y, size_t n) override;
+    void end() override;
+
+private:
+    size_t capacity;
+    size_t count;
+    size_t dimension;
+    FlushFunction flush;
+    std::vector<double> xBuffer;
+    std::vector<double> yBuffer;
+
+    void flushBuffer();
+};
+
+/**
+ * @class FileObserver
+ * @brief Writes every point as a CSV row (x,y or x,y0,y1,...) to a file
+ *
+ * The file holds the trajectory of the last solve; each solve truncates it.
+ */
+class FileObserver : public StepObserver {
+public:
+    /**
+     * @brief Constructor
+     * @param filename Name of the file to write to
+     */
+    explicit FileObserver(const std::string& filename);
+
+    /**
+     * @brief Destructor, closes the file
+     */
+    ~FileObserver();
+
+    void begin(const std::string& methodName, long expectedSteps) override;
+    void observe(double x, const double* y, size_t n) override;
+    void end() override;
+
+private:
+    std::string filename;
+    std::FILE* file;
+    std::vector<char> buffer;
+    bool headerWritten;
+    bool written;           // Something has been written since the file was opened
+
+    FileObserver(const FileObserver&);
+    FileObserver& operator=(const FileObserver&);
+};
+
+#endif // STEP_OBSERVER_H
@@ -0,0 +1,109 @@
+/**
+ * @file SwitchingMethod.h
+ * @brief Solver switching between Dormand-Prince and BDF as stiffness comes and goes
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef SWITCHING_METHOD_H
+#define SWITCHING_METHOD_H
+
+#include "BDF.h"
+#include <iosfwd>
+
+/**
+ * @class SwitchingMethod
+ * @brief Adaptive solver that detects stiffness and switches methods
+ *
+ * The solve starts with the explicit Dormand-Prince 5(4) pair. After each
+ * accepted step, |f(y_{n+1}) - f(y*)| / |y_{n+1} - y*|, with y* the state
+ * of the 6th stage at the same x, estimates the dominant eigenvalue of the
+ * Jacobian. When h times this estimate stays near the edge of the stability
+ * region for 15 steps, the step size is bounded by stability instead of
+ * accuracy and the solve continues with BDF.
+ *
+ * Every 10 BDF steps J is evaluated again; when h times its norm is inside
+ * the stability region at two checks in a row, Dormand-Prince could take
+ * the same steps and the solve switches back. getPhases() tells where the
+ * switches happened and what each phase cost.
+ *
+ * Tolerances, Jacobians and the statistics are those of ImplicitMethod.
+ * As with BDF, only the size of the initial step is used, and the solve
+ * runs backward when xTarget < x0.
+ */
+class SwitchingMethod : public BDF {
+public:
+    /**
+     * @brief Part of the solve done by one method
+     */
+    struct Phase {
+        bool stiff;                 // True for BDF, false for Dormand-Prince
+        double xStart;
+        double xEnd;
+        int steps;                  // Accepted steps
+        long evaluations;           // Function evaluations, Jacobians included
+        long jacobianEvaluations;
+        long factorizations;
+    };
+
+    /**
+     * @brief Constructor
+     * @param diffFunc Function representing the differential equation
+     */
+    SwitchingMethod(std::function<double(double, double)> diffFunc = differentialFunction);
+
+    /**
+     * @brief Solve the single differential equation; verbose output lists the phases
+     */
+    void solve() override;
+
+    /**
+     * @brief Solve the system of differential equations; verbose output lists the phases
+     */
+    void solveSystem() override;
+
+    /**
+     * @brief Get the phases of the last solve, in order
+     */
+    const std::vector<Phase>& getPhases() const;
+
+    /**
+     * @brief Print the phases of the last solve as a table
+     */
+    void printPhases(std::ostream& out) const;
+
+    /**
+     * @brief Get the method name
+     * @return String "Dormand-Prince/BDF Switching Method"
+     */
+    std::string getMethodName() const override;
+
+protected:
+    void integrate(double* y) override;
+    bool stopAfterStep(double x, const double* y, double h) override;
+
+private:
+    std::vector<Phase> phases;
+    int stepsSinceCheck;        // BDF steps since J was last checked
+    int nonStiffChecks;         // Checks in a row that found no stiffness
+
+    /**
+     * @brief Buffers of advanceExplicit(), taken from the workspace once per solve
+     */
+    struct ExplicitBuffers {
+        double* k;              // Stage values, k[s * n + i]
+        double* stage;
+        double* lastStage;      // State of the 6th stage, for the eigenvalue estimate
+        double* yNew;
+        double* error;
+    };
+
+    /**
+     * @brief Take Dormand-Prince steps until xTarget or stiffness is detected
+     * @param h Signed step, as in BDF::advance
+     * @param work Buffers reused by every explicit phase of the solve
+     */
+    void advanceExplicit(double& x, double* y, double& h, const ExplicitBuffers& work);
+};
+
+#endif // SWITCHING_METHOD_H
@@ -0,0 +1,147 @@
+/**
+ * @file TaylorMethod.h
+ * @brief Taylor series method with coefficients from automatic differentiation
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef TAYLOR_METHOD_H
+#define TAYLOR_METHOD_H
+
+#include "NumericalMethod.h"
+#include "ErrorTolerance.h"
+#include "Jet.h"
+#include <vector>
+
+/**
+ * @struct DefaultEquation
+ * @brief Templated form of differentialFunction, dy/dx = x + y
+ *
+ * The Taylor method needs a right-hand side it can evaluate on Jets, so it
+ * cannot use differentialFunction itself. Keep the two in sync.
+ */
+struct DefaultEquation {
+    template <typename T>
+    T operator()(const T& x, const T& y) const {
+        return x + y;
+    }
+};
+
+/**
+ * @class TaylorMethod
+ * @brief Explicit Taylor series method of adjustable order and step size
+ *
+ * Each step evaluates the right-hand side on Jets to get the Taylor
+ * coefficients y_0, ..., y_p of the solution at the current point, where
+ * y_(k+1) is coefficient k of f(x + t, y(x + t)) divided by k + 1. The
+ * step is taken by summing the series.
+ *
+ * The last two coefficients estimate the radius of convergence by the
+ * root test, and the step is the fraction of it at which the first
+ * neglected terms meet the tolerance (Jorba & Zou, Experimental
+ * Mathematics 14, 2005). High orders thus take large steps on smooth
+ * problems and shrink them near singularities.
+ *
+ * The right-hand side must be a functor whose operator() is a template, or
+ * is overloaded for double and Jet, see Jet. Only single equations are
+ * supported, and results are kept in full precision. The step size given
+ * to setParameters is not used; the method integrates backward when
+ * xTarget < x0.
+ */
+class TaylorMethod : public NumericalMethod {
+public:
+    /**
+     * @brief Order used when none is given
+     */
+    static const int DEFAULT_ORDER = 16;
+
+    /**
+     * @brief Right-hand side evaluated on Jets
+     */
+    typedef std::function<Jet(const Jet& x, const Jet& y)> JetFunction;
+
+    /**
+     * @brief Constructor for the default equation
+     * @param order Order of the method, from 1 to Jet::MAX_DEGREE
+     */
+    explicit TaylorMethod(int order = DEFAULT_ORDER);
+
+    /**
+     * @brief Constructor for a templated right-hand side
+     * @param rhs Functor callable on (double, double) and on (Jet, Jet)
+     * @param order Order of the method, from 1 to Jet::MAX_DEGREE
+     */
+    template <typename Rhs>
+    explicit TaylorMethod(const Rhs& rhs, int order = DEFAULT_ORDER)
+        : NumericalMethod([rhs](double x, double y) { return rhs(x, y); }),
+          jetFunction([rhs](const Jet& x, const Jet& y) { return rhs(x, y); }) {
+        initialize(order);
+    }
+
+    /**
+     * @brief Set the order of the method
+     * @param order From 1 to Jet::MAX_DEGREE
+     */
+    void setOrder(int order);
+
+    /**
+     * @brief Get the order of the method
+     */
+    int getOrder() const;
+
+    /**
+     * @brief Set the error tolerances
+     * @param absTol Absolute tolerance
+     * @param relTol Relative tolerance
+     */
+    void setTolerances(double absTol, double relTol);
+
+    /**
+     * @brief Solve the differential equation using the Taylor series method
+     */
+    void solve() override;
+
+    /**
+     * @brief Get the number of Jet evaluations of the right-hand side in the last solve
+     *
+     * A step needs one evaluation per order, each of them costlier than
+     * a plain evaluation.
+     */
+    long getJetEvaluations() const;
+
+    /**
+     * @brief Get the number of steps of the last solve
+     */
+    int getSteps() const;
+
+    /**
+     * @brief Get the method name
+     * @return String "Taylor Series Method (order p)"
+     */
+    std::string getMethodName() const override;
+
+private:
+    JetFunction jetFunction;
+    int order;
+    ErrorTolerance tolerances;
+    long jetEvaluations;            // Jet evaluations in the last solve
+    std::vector<double> series;     // Taylor coefficients of the current step
+
+    /**
+     * @brief Set the defaults; shared by the constructors
+     */
+    void initialize(int orderVal);
+
+    /**
+     * @brief Compute the Taylor coefficients of the solution through (x, y) into series
+     */
+    void expand(double x, double y);
+
+    /**
+     * @brief Step size from the last two coefficients and the tolerances
+     * @param y Value at the start of the step
+     */
+    double chooseStep(double y) const;
+};
+
+#endif // TAYLOR_METHOD_H
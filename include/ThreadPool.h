@@ -0,0 +1,93 @@
+/**
+ * @file ThreadPool.h
+ * @brief Fixed-size, work-stealing pool of worker threads
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <atomic>
+#include <type_traits>
+
+/**
+ * @class ThreadPool
+ * @brief Runs submitted tasks on a fixed set of worker threads
+ *
+ * Every worker owns a task queue. Tasks submitted from outside the pool
+ * are spread over the queues round-robin; tasks submitted by a running
+ * task go to the queue of its own worker. A worker takes its newest task
+ * first and, when its queue is empty, steals the oldest task of another
+ * worker, so tasks of very different cost still keep every worker busy.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Constructor, starts the workers
+     * @param threads Number of workers, 0 for one per core
+     */
+    explicit ThreadPool(unsigned threads = 0);
+
+    /**
+     * @brief Destructor, finishes queued tasks and joins the workers
+     */
+    ~ThreadPool();
+
+    /**
+     * @brief Queue a task
+     * @param task Callable taking no arguments
+     * @return Future receiving the result or the exception of the task
+     */
+    template <typename Func>
+    std::future<typename std::result_of<Func()>::type> submit(Func task) {
+        typedef typename std::result_of<Func()>::type Result;
+        std::shared_ptr<std::packaged_task<Result()> > packaged =
+            std::make_shared<std::packaged_task<Result()> >(task);
+        std::future<Result> future = packaged->get_future();
+        enqueue([packaged]() { (*packaged)(); });
+        return future;
+    }
+
+    /**
+     * @brief Get the number of worker threads
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get the number of tasks taken from another worker's queue so far
+     */
+    size_t getStealCount() const;
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()> > tasks;
+    };
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<WorkerQueue> > queues;
+    std::atomic<size_t> pending;        // Queued tasks not yet taken
+    std::atomic<size_t> nextQueue;      // Round-robin target for outside submissions
+    std::atomic<size_t> steals;
+    std::mutex sleepMutex;
+    std::condition_variable available;
+    bool stopping;
+
+    void enqueue(std::function<void()> task);
+    bool takeTask(size_t index, std::function<void()>& task);
+    void workerLoop(size_t index);
+
+    ThreadPool(const ThreadPool&);
+    ThreadPool& operator=(const ThreadPool&);
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,132 @@
+/**
+ * @file TracePipeline.h
+ * @brief Background formatting of verbose step output
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef TRACE_PIPELINE_H
+#define TRACE_PIPELINE_H
+
+#include "SpscRingBuffer.h"
+#include <ostream>
+#include <thread>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @struct StepRecord
+ * @brief Everything the verbose output of one step needs
+ *
+ * Fields a method does not use are left at zero.
+ */
+struct StepRecord {
+    enum Kind {
+        Accepted,   // A completed step
+        Rejected    // A step rejected by an adaptive method; shown without delay
+    };
+
+    Kind kind;
+    long step;          // Step number as shown to the user
+    double xStart;      // x and y at the start of the step
+    double yStart;
+    double x;           // x and y at the end of the step
+    double y;
+    double k[4];        // Stage slopes
+    double increment;   // Change of y over the step (delta k, predictor, ...)
+    double h;           // Step size
+    double errorEstimate;
+    double exact;       // Exact solution at x, filled in when it is compared
+
+    StepRecord()
+        : kind(Accepted), step(0), xStart(0.0), yStart(0.0), x(0.0), y(0.0),
+          increment(0.0), h(0.0), errorEstimate(0.0), exact(0.0) {
+        k[0] = k[1] = k[2] = k[3] = 0.0;
+    }
+};
+
+/**
+ * @brief Writes one step record in the style of a method
+ * @param out Stream to write to
+ * @param record Step to write
+ * @param compareExact True to add the exact solution and error
+ */
+typedef void (*StepFormatter)(std::ostream& out, const StepRecord& record, bool compareExact);
+
+/**
+ * @class TracePipeline
+ * @brief Hands step records from the solver to a formatting thread
+ *
+ * The solver pushes records into a lock-free ring buffer and never waits
+ * on the console; a consumer thread formats them and applies the
+ * presentation delay. The delay is skipped while more than a screenful of
+ * records is queued, so only the last steps of a long run are paced; the
+ * solver only blocks if formatting itself falls a whole buffer behind.
+ */
+class TracePipeline {
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Records buffered between solver and consumer
+     */
+    explicit TracePipeline(size_t capacity = 8192);
+
+    /**
+     * @brief Destructor, finishes a running trace
+     */
+    ~TracePipeline();
+
+    /**
+     * @brief Start the consumer thread
+     * @param out Stream the records are written to
+     * @param formatterFunc Formatter of the method being traced
+     * @param compareExactVal Passed on to the formatter
+     * @param delayMillis Pause after each accepted step, for reading along
+     */
+    void start(std::ostream& out, StepFormatter formatterFunc, bool compareExactVal, int delayMillis);
+
+    /**
+     * @brief Queue a record; solver thread only
+     */
+    void push(const StepRecord& record);
+
+    /**
+     * @brief Wait until every queued record is written, then stop the consumer
+     */
+    void finish();
+
+    /**
+     * @brief Check whether the consumer thread is running
+     */
+    bool isRunning() const;
+
+private:
+    SpscRingBuffer<StepRecord> buffer;
+    std::thread consumer;
+    std::atomic<bool> producing;
+    std::ostream* output;
+    StepFormatter formatter;
+    bool compareExact;
+    int delay;
+
+    void consume();
+
+    TracePipeline(const TracePipeline&);
+    TracePipeline& operator=(const TracePipeline&);
+};
+
+/**
+ * @name Step formatters
+ * Reproduce the verbose output of each method.
+ * @{
+ */
+void formatEulerStep(std::ostream& out, const StepRecord& record, bool compareExact);
+void formatModifiedEulerStep(std::ostream& out, const StepRecord& record, bool compareExact);
+void formatRungeKutta2Step(std::ostream& out, const StepRecord& record, bool compareExact);
+void formatRungeKutta4Step(std::ostream& out, const StepRecord& record, bool compareExact);
+void formatAdamsBashforthStep(std::ostream& out, const StepRecord& record, bool compareExact);
+void formatAdamsMoultonStep(std::ostream& out, const StepRecord& record, bool compareExact);
+void formatDormandPrinceStep(std::ostream& out, const StepRecord& record, bool compareExact);
+/** @} */
+
+#endif // TRACE_PIPELINE_H
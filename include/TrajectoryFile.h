@@ -0,0 +1,154 @@
+/**
+ * @file TrajectoryFile.h
+ * @brief Versioned binary trajectory format with a memory-mapped reader
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Layout (native byte order, version 1):
+ *
+ *   [0, 256)        TrajectoryHeader
+ *   xOffset         x column: pointCount doubles
+ *   yOffset         y columns: dimension columns of pointCount doubles each,
+ *                   component 0 first
+ *
+ * Columns are 8-byte aligned, so a reader can use them in place.
+ */
+
+#ifndef TRAJECTORY_FILE_H
+#define TRAJECTORY_FILE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+/**
+ * @struct TrajectoryHeader
+ * @brief Fixed-size header at the start of every trajectory file
+ */
+struct TrajectoryHeader {
+    char magic[8];              // "ODETRAJ" followed by a zero byte
+    uint32_t version;           // Format version
+    uint32_t byteOrder;         // 0x01020304 as written by the producer
+    uint32_t headerSize;        // Size of this header in bytes
+    uint32_t dimension;         // Components per state (1 for scalar problems)
+    uint64_t pointCount;        // Points per column (steps + 1)
+    uint64_t stepCount;         // Steps taken by the method
+    double x0;                  // Initial x value
+    double stepSize;            // Step size h (initial guess for adaptive methods)
+    uint64_t xOffset;           // Byte offset of the x column
+    uint64_t yOffset;           // Byte offset of the first y column
+    char methodName[64];        // Zero-terminated method name
+    char equationId[64];        // Zero-terminated identifier of the equation
+    char reserved[56];          // Zero, pads the header to 256 bytes
+};
+
+/**
+ * @struct ColumnView
+ * @brief Read-only view of one column of doubles
+ */
+struct ColumnView {
+    const double* data;
+    size_t size;
+
+    const double& operator[](size_t i) const { return data[i]; }
+    const double* begin() const { return data; }
+    const double* end() const { return data + size; }
+};
+
+/**
+ * @struct TrajectoryInfo
+ * @brief Metadata written to the header of a trajectory file
+ */
+struct TrajectoryInfo {
+    std::string methodName;
+    std::string equationId;
+    double x0;
+    double stepSize;
+    uint64_t stepCount;
+};
+
+/**
+ * @class TrajectoryFile
+ * @brief Memory-mapped, read-only trajectory file
+ *
+ * Columns are returned as views directly over the mapping, so loading a
+ * file copies no data. The views stay valid while the object lives.
+ */
+class TrajectoryFile {
+public:
+    /**
+     * @brief Current version of the format
+     */
+    static const uint32_t VERSION = 1;
+
+    /**
+     * @brief Write a trajectory file
+     * @param filename Name of the file to write to
+     * @param info Metadata for the header
+     * @param x x values, `count` of them
+     * @param y States, `count` rows of `dimension` values
+     * @param count Number of points
+     * @param dimension Components per state
+     */
+    static void write(const std::string& filename, const TrajectoryInfo& info,
+                      const double* x, const double* y, size_t count, size_t dimension);
+
+    /**
+     * @brief Open and map a trajectory file
+     * @param filename Name of the file to read
+     */
+    explicit TrajectoryFile(const std::string& filename);
+
+    /**
+     * @brief Destructor, unmaps the file
+     */
+    ~TrajectoryFile();
+
+    /**
+     * @brief Get the header of the file
+     */
+    const TrajectoryHeader& getHeader() const;
+
+    /**
+     * @brief Get the name of the method that produced the file
+     */
+    std::string getMethodName() const;
+
+    /**
+     * @brief Get the identifier of the equation
+     */
+    std::string getEquationId() const;
+
+    /**
+     * @brief Get the number of points in every column
+     */
+    size_t getPointCount() const;
+
+    /**
+     * @brief Get the number of state components
+     */
+    size_t getDimension() const;
+
+    /**
+     * @brief Get the x column
+     */
+    ColumnView getX() const;
+
+    /**
+     * @brief Get one y column
+     * @param component Index of the state component
+     */
+    ColumnView getY(size_t component = 0) const;
+
+private:
+    const char* data;
+    size_t size;
+    bool mapped;                // False when the file was read into fallback
+    std::vector<char> fallback; // Used where mmap is unavailable
+
+    TrajectoryFile(const TrajectoryFile&);
+    TrajectoryFile& operator=(const TrajectoryFile&);
+};
+
+#endif // TRAJECTORY_FILE_H
@@ -0,0 +1,40 @@
+/**
+ * @file Trapezoidal.h
+ * @brief Implicit trapezoidal rule for stiff ODEs
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef TRAPEZOIDAL_H
+#define TRAPEZOIDAL_H
+
+#include "ImplicitMethod.h"
+
+/**
+ * @class Trapezoidal
+ * @brief Fixed-step y_{n+1} = y_n + h/2 * (f_n + f_{n+1}), 2nd order and A-stable
+ *
+ * Stiff components are damped only weakly: with a large step they
+ * oscillate in sign while decaying. Use BackwardEuler or BDF when that
+ * matters.
+ */
+class Trapezoidal : public ImplicitMethod {
+public:
+    /**
+     * @brief Constructor
+     * @param diffFunc Function representing the differential equation
+     */
+    Trapezoidal(std::function<double(double, double)> diffFunc = differentialFunction);
+
+    /**
+     * @brief Get the method name
+     * @return String "Trapezoidal Method"
+     */
+    std::string getMethodName() const override;
+
+protected:
+    void integrate(double* y) override;
+    StepFormatter stepFormatter() const override;
+};
+
+#endif // TRAPEZOIDAL_H
@@ -9,6 +9,7 @@
 #define UTILITY_H
 
 #include <vector>
+#include <string>
 #include "NumericalMethod.h"
 
 /**
@@ -23,6 +24,53 @@ public:
      */
     static void compareAllMethods(const std::vector<NumericalMethod*>& methods);
     
+    /**
+     * @brief Compare all methods and print a summary with the time each solve took
+     * @param methods Vector of solved numerical methods
+     * @param wallTimes Wall time of each solve in milliseconds, as returned by solveAll
+     */
+    static void compareAllMethods(const std::vector<NumericalMethod*>& methods,
+                                  const std::vector<double>& wallTimes);
+    
+    /**
+     * @brief Solve every method, each on its own worker thread when parallel
+     *
+     * Parameters must already be set, and the methods must solve the same
+     * equation. Fixed-step Adams-Bashforth methods are solved after the
+     * first RungeKutta4 in the list, on the same worker, and take their
+     * startup points from its result when x0, y0 and h match. Their rows
+     * still include the RK4 calls of the startup and the matching share of
+     * the RK4 time.
+     *
+     * @param methods Vector of numerical methods
+     * @param parallel True to run the solves concurrently on a thread pool
+     * @return Wall time of each solve in milliseconds
+     */
+    static std::vector<double> solveAll(const std::vector<NumericalMethod*>& methods, bool parallel = true);
+    
+    /**
+     * @brief Create a method from its short name
+     *
+     * Names are euler, modified-euler (or heun), rk2, rk4,
+     * adams-bashforth (or ab), adams-bashforth-moulton (or abm),
+     * adaptive-adams, dormand-prince (or dp), bulirsch-stoer (or bs),
+     * backward-euler, trapezoidal, bdf, switching and taylor. ab1 to ab5
+     * and abm1 to abm5 select the order of the Adams methods, 4 by default;
+     * bdf1 to bdf5 limit the order of BDF. taylor only solves the default
+     * equation, see TaylorMethod for other equations.
+     *
+     * @param name Short name of the method
+     * @param diffFunc Function representing the differential equation
+     * @return New method; the caller takes ownership
+     */
+    static NumericalMethod* createMethod(const std::string& name,
+                                         std::function<double(double, double)> diffFunc = differentialFunction);
+    
+    /**
+     * @brief Get the short names accepted by createMethod
+     */
+    static std::vector<std::string> getMethodNames();
+    
     /**
      * @brief Clear the console screen
      */
@@ -0,0 +1,132 @@
+/**
+ * @file WorkPrecision.h
+ * @brief Measures the cost and accuracy of methods over a series of step sizes
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef WORK_PRECISION_H
+#define WORK_PRECISION_H
+
+#include "NumericalMethod.h"
+#include <vector>
+#include <string>
+#include <functional>
+
+/**
+ * @struct WorkPrecisionPoint
+ * @brief Cost and accuracy of one method at one step size
+ */
+struct WorkPrecisionPoint {
+    std::string method;     // getMethodName() of the method
+    int level;              // Refinement level, 0 for the largest step size
+    double stepSize;        // Step size (initial step size for adaptive methods)
+    double tolerance;       // Error tolerance of adaptive methods, 0 otherwise
+    long evaluations;       // Calls of the differential function
+    double seconds;         // Fastest wall time of the repeated solves
+    double error;           // calculateError(), the maximum error against exactSolution
+    double observedOrder;   // Order in h from the previous level; NaN on level 0 and for adaptive methods
+};
+
+/**
+ * @class WorkPrecision
+ * @brief Runs methods over h, h/2, h/4, ... and records work against error
+ *
+ * Every run solves dy/dx = differentialFunction from (0, 1) to xTarget,
+ * so calculateError() can compare it with exactSolution. Adaptive methods
+ * (Dormand-Prince) keep the initial step size and tighten their tolerance
+ * by 2^-5 per level instead.
+ *
+ * The observed order of fixed-step methods is log2(e(2h) / e(h)), the
+ * order in h from two consecutive levels. Adaptive methods have no step
+ * size to halve, so they report none; compare their error against the
+ * evaluations instead.
+ */
+class WorkPrecision {
+public:
+    /**
+     * @brief Creates a method using the given (counting) differential function
+     */
+    typedef std::function<NumericalMethod*(std::function<double(double, double)>)> MethodFactory;
+
+    /**
+     * @brief Constructor
+     */
+    WorkPrecision();
+
+    /**
+     * @brief Add a method to measure
+     * @param factory Creates the method; the caller of the factory owns it
+     */
+    void addMethod(MethodFactory factory);
+
+    /**
+     * @brief Add every method of the solver
+     */
+    void addAllMethods();
+
+    /**
+     * @brief Set the step sizes to h0, h0/2, ..., h0/2^(levels-1)
+     * @param h0 Largest step size
+     * @param levelCount Number of step sizes
+     */
+    void setStepSizes(double h0, int levelCount);
+
+    /**
+     * @brief Set the end of the interval
+     * @param xTargetVal Target x value, the interval starts at 0
+     */
+    void setTarget(double xTargetVal);
+
+    /**
+     * @brief Set how many times each solve is timed; the fastest time is kept
+     * @param count Number of timed solves
+     */
+    void setRepeats(int count);
+
+    /**
+     * @brief Measure every method at every step size
+     * @return Points grouped by method, in order of refinement
+     */
+    const std::vector<WorkPrecisionPoint>& run();
+
+    /**
+     * @brief Get the points of the last run
+     */
+    const std::vector<WorkPrecisionPoint>& getPoints() const;
+
+    /**
+     * @brief Find the cheapest measured run whose error meets a target
+     * @param targetError Largest acceptable error
+     * @param byEvaluations True to compare evaluation counts instead of wall time
+     * @return The point, or NULL if no run reached the target
+     */
+    const WorkPrecisionPoint* cheapest(double targetError, bool byEvaluations = false) const;
+
+    /**
+     * @brief Print the points as a table
+     */
+    void printTable() const;
+
+    /**
+     * @brief Save the points to a CSV file
+     * @param filename Name of the file to save to
+     */
+    void saveToCSV(const std::string& filename) const;
+
+    /**
+     * @brief Save the points to a JSON file
+     * @param filename Name of the file to save to, or "-" for standard output
+     */
+    void saveToJSON(const std::string& filename) const;
+
+private:
+    std::vector<MethodFactory> factories;
+    double largestStep;
+    int levels;
+    double xTarget;
+    int repeats;
+    std::vector<WorkPrecisionPoint> points;
+};
+
+#endif // WORK_PRECISION_H
@@ -0,0 +1,61 @@
+/**
+ * @file Workspace.h
+ * @brief Arena for the scratch buffers of repeated solves
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+/**
+ * @class Workspace
+ * @brief Bump allocator of double buffers that keeps its memory between solves
+ *
+ * Buffers are handed out from large blocks and all released together by
+ * clear(). When one solve needed more than one block, clear() merges them
+ * into a single block, so from the second solve of the same size on no
+ * heap memory is allocated.
+ */
+class Workspace {
+public:
+    /**
+     * @brief Buffers start a multiple of this many doubles into their block;
+     *        the block itself has the alignment of new double[]
+     */
+    static const size_t ALIGNMENT = 8;
+
+    Workspace();
+
+    /**
+     * @brief Get a buffer; valid until the next clear()
+     * @param count Number of doubles
+     * @return Uninitialized buffer of count doubles
+     */
+    double* allocate(size_t count);
+
+    /**
+     * @brief Release every buffer, keeping the memory for the next solve
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of doubles the workspace holds
+     */
+    size_t capacity() const;
+
+private:
+    std::vector<std::unique_ptr<double[]> > blocks;
+    std::vector<size_t> blockSizes;
+    size_t current;     // Block buffers are taken from
+    size_t used;        // Doubles taken from the current block
+
+    Workspace(const Workspace&);
+    Workspace& operator=(const Workspace&);
+};
+
+#endif // WORKSPACE_H
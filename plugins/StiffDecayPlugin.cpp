@@ -0,0 +1,44 @@
+/**
+ * @file StiffDecayPlugin.cpp
+ * @brief Example plugin: dy/dx = -50 * (y - cos x), y(0) = 1
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Exports every function of OdePlugin.h. Build it as a shared library and
+ * run, for example:
+ *
+ *   solver --method bdf --plugin lib/stiff_decay_plugin.so --x-target 2 --h 0.01 --exact
+ */
+
+#include "OdePlugin.h"
+#include <cmath>
+
+namespace {
+
+const double RATE = 50.0;
+
+} // namespace
+
+ODE_PLUGIN_EXPORT int ode_plugin_abi_version(void) {
+    return ODE_PLUGIN_ABI_VERSION;
+}
+
+ODE_PLUGIN_EXPORT double ode_plugin_rhs(double x, double y) {
+    return -RATE * (y - std::cos(x));
+}
+
+ODE_PLUGIN_EXPORT void ode_plugin_rhs_batch(size_t count, const double* x, const double* y, double* dydx) {
+    for (size_t i = 0; i < count; ++i) {
+        dydx[i] = -RATE * (y[i] - std::cos(x[i]));
+    }
+}
+
+// Solution for y(0) = 1
+ODE_PLUGIN_EXPORT double ode_plugin_exact(double x) {
+    double scale = RATE / (RATE * RATE + 1.0);
+    return scale * (RATE * std::cos(x) + std::sin(x)) + (1.0 - RATE * scale) * std::exp(-RATE * x);
+}
+
+ODE_PLUGIN_EXPORT double ode_plugin_jacobian(double, double) {
+    return -RATE;
+}
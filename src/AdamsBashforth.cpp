@@ -1,118 +1,598 @@
 /**
  * @file AdamsBashforth.cpp
- * @brief Implementation of Adams-Bashforth method
+ * @brief Implementation of the Adams-Bashforth and Adams-Bashforth-Moulton methods
  * @author Prathamesh Khade
  * @date 2025-06-07
  */
 
 #include "AdamsBashforth.h"
-#include "RungeKutta4.h"
+#include "StaticSolver.h"
+#include "PrecisionPolicy.h"
 #include <iostream>
 #include <iomanip>
-#include <chrono>
-#include <thread>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
 
-AdamsBashforth::AdamsBashforth(std::function<double(double, double)> diffFunc) 
-    : NumericalMethod(diffFunc) {}
+namespace {
+
+// Adams-Bashforth weights of orders 1 to 5, newest slope first, over a common denominator
+const double AB_WEIGHTS[5][5] = {
+    { 1.0 },
+    { 3.0, -1.0 },
+    { 23.0, -16.0, 5.0 },
+    { 55.0, -59.0, 37.0, -9.0 },
+    { 1901.0, -2774.0, 2616.0, -1274.0, 251.0 }
+};
+const double AB_DENOMINATORS[5] = { 1.0, 2.0, 12.0, 24.0, 720.0 };
+
+// Adams-Moulton weights of orders 1 to 5, starting with the predicted slope
+const double AM_WEIGHTS[5][5] = {
+    { 1.0 },
+    { 1.0, 1.0 },
+    { 5.0, 8.0, -1.0 },
+    { 9.0, 19.0, -5.0, 1.0 },
+    { 251.0, 646.0, -264.0, 106.0, -19.0 }
+};
+const double AM_DENOMINATORS[5] = { 1.0, 2.0, 12.0, 24.0, 720.0 };
+
+// Milne's estimate: the corrector error is C_AM / (C_AB - C_AM) times the
+// predictor-corrector difference, from the error constants of each order
+const double MILNE_FACTORS[5] = { 1.0 / 2.0, 1.0 / 6.0, 1.0 / 10.0, 19.0 / 270.0, 27.0 / 502.0 };
+
+// Slopes kept; a power of 2 with room for the 2 * order - 1 slopes a doubled step needs
+const unsigned HISTORY = 16;
+const unsigned HISTORY_MASK = HISTORY - 1;
+
+// Step size control of the adaptive mode
+const double GROWTH_SAFETY = 0.5;   // Doubled step must be estimated this far inside the tolerance
+const int MAX_STEPS = 10000000;
+
+// h times the Adams-Bashforth sum over the slopes ending at index newest
+double predictorIncrement(int order, double h, const double* slopes, unsigned newest) {
+    const double* weights = AB_WEIGHTS[order - 1];
+    double sum = weights[0] * slopes[newest & HISTORY_MASK];
+    for (int i = 1; i < order; ++i) {
+        sum += weights[i] * slopes[(newest - i) & HISTORY_MASK];
+    }
+    return h * sum / AB_DENOMINATORS[order - 1];
+}
+
+// h times the Adams-Moulton sum of the predicted slope and the slopes ending at index newest
+double correctorIncrement(int order, double h, double fPredicted, const double* slopes, unsigned newest) {
+    const double* weights = AM_WEIGHTS[order - 1];
+    double sum = weights[0] * fPredicted;
+    for (int i = 1; i < order; ++i) {
+        sum += weights[i] * slopes[(newest - (i - 1)) & HISTORY_MASK];
+    }
+    return h * sum / AM_DENOMINATORS[order - 1];
+}
+
+// Slope back steps before the newest one, from the polynomial through the last order slopes
+double interpolateSlope(int order, double back, const double* slopes, unsigned newest) {
+    double value = 0.0;
+    for (int j = 0; j < order; ++j) {
+        double weight = 1.0;
+        for (int m = 0; m < order; ++m) {
+            if (m != j) {
+                weight *= (m - back) / (m - j);
+            }
+        }
+        value += weight * slopes[(newest - j) & HISTORY_MASK];
+    }
+    return value;
+}
+
+// Estimated local error of the given order, from the same predicted slope
+double milneEstimate(int order, double h, double fPredicted, const double* slopes, unsigned newest) {
+    return MILNE_FACTORS[order - 1] * std::abs(correctorIncrement(order, h, fPredicted, slopes, newest) -
+                                               predictorIncrement(order, h, slopes, newest));
+}
+
+} // namespace
+
+AdamsBashforth::AdamsBashforth(std::function<double(double, double)> diffFunc, int orderVal, Mode modeVal)
+    : NumericalMethod(diffFunc), order(orderVal), mode(modeVal),
+      evaluations(0), acceptedSteps(0), rejectedSteps(0), sharedStartupSteps(0) {
+    if (orderVal < MIN_ORDER || orderVal > MAX_ORDER) {
+        throw std::invalid_argument("Adams methods are available for orders 1 to 5");
+    }
+}
+
+void AdamsBashforth::setTolerances(double absTol, double relTol) {
+    tolerances.set(absTol, relTol);
+}
+
+void AdamsBashforth::setStartupValues(const std::vector<double>& xs, const std::vector<double>& ys) {
+    // Only the first MAX_ORDER points can be needed
+    size_t count = std::min(std::min(xs.size(), ys.size()), static_cast<size_t>(MAX_ORDER));
+    startupX.assign(xs.begin(), xs.begin() + count);
+    startupY.assign(ys.begin(), ys.begin() + count);
+}
+
+int AdamsBashforth::getSharedStartupSteps() const {
+    return sharedStartupSteps;
+}
+
+int AdamsBashforth::startupPoints() const {
+    // Never step past the target
+    return std::min(order, std::max(steps, 0) + 1);
+}
+
+long AdamsBashforth::computeStartup(double* xs, double* ys) const {
+    long calls = 0;
+    auto rhs = [this, &calls](double x, double y) {
+        ++calls;
+        return diffFunction(x, y);
+    };
+
+    // Same steps and rounding as RungeKutta4::solve
+    double k[RungeKutta4Stepper::stages];
+    xs[0] = x0;
+    ys[0] = y0;
+    for (int i = 1; i < startupPoints(); ++i) {
+        double deltaK = RungeKutta4Stepper::step(rhs, xs[i - 1], ys[i - 1], stepSize, k);
+        deltaK = PrecisionPolicy::apply(deltaK);
+        xs[i] = xs[i - 1] + stepSize;
+        ys[i] = PrecisionPolicy::apply(ys[i - 1] + deltaK);
+    }
+    return calls;
+}
 
 void AdamsBashforth::solve() {
-    // For Adams-Bashforth, we need to use RK4 for the first 4 steps
-    RungeKutta4 rk4(diffFunction);
-    rk4.setVerbose(false);
-    rk4.setParameters(x0, y0, x0 + 3 * stepSize, stepSize);
-    rk4.solve();
-    
-    // Get the first 4 points from RK4
-    xValues = rk4.getXValues();
-    yValues = rk4.getYValues();
-    
-    // Calculate the remaining points using Adams-Bashforth
-    double x = xValues.back();
-    double y = yValues.back();
-    
+    if (mode == Mode::Adaptive) {
+        solveAdaptive();
+        return;
+    }
+
+    std::ostream& out = traceStream();
+    const int points = startupPoints();
+
+    beginSolve();
+
+    // Use the supplied startup points if they belong to this problem
+    bool haveStartup = startupX.size() >= static_cast<size_t>(points) &&
+                       startupY.size() >= static_cast<size_t>(points) &&
+                       startupX[0] == x0 && startupY[0] == y0 &&
+                       (points == 1 || std::abs(startupX[1] - startupX[0] - stepSize) <= 1e-12 * std::abs(stepSize));
+
+    // Otherwise use RK4 for the first steps
+    double startX[MAX_ORDER], startY[MAX_ORDER];
+    if (haveStartup) {
+        // The calls were made by the solver the points came from; count them here too
+        std::copy(startupX.begin(), startupX.begin() + points, startX);
+        std::copy(startupY.begin(), startupY.begin() + points, startY);
+        instrumentation.countCalls(static_cast<long>(RungeKutta4Stepper::stages) * (points - 1));
+        sharedStartupSteps = points - 1;
+    }
+    else {
+        instrumentation.countCalls(computeStartup(startX, startY));
+        sharedStartupSteps = 0;
+    }
+
+    // The startup points begin with the initial point, which is already stored
+    if (!observer) {
+        xValues.assign(1, startX[0]);
+        yValues.assign(1, startY[0]);
+    }
+    for (int i = 1; i < points; ++i) {
+        recordStep(startX[i], startY[i]);
+    }
+
+    // Calculate the remaining points using the Adams formulas
+    double x = startX[points - 1];
+    double y = startY[points - 1];
+
     if (verbose) {
-        std::cout << "\n=== Adams-Bashforth Method ===" << std::endl;
-        std::cout << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0 
-                  << ", y0 = " << y0 << std::endl;
-        std::cout << "Step size: h = " << stepSize << std::endl;
-        std::cout << "Target x: " << xTarget << std::endl;
-        std::cout << "Using RK4 for first 4 steps" << std::endl;
-        
-        for (size_t i = 0; i < xValues.size(); ++i) {
-            std::cout << "Initial point " << i << ": x = " << std::fixed << std::setprecision(4) 
-                      << xValues[i] << ", y = " << yValues[i] << std::endl;
-        }
-    }
-    
-    // Store the function values at the last 4 points
-    std::vector<double> fValues;
-    for (int i = 0; i < 4; ++i) {
-        fValues.push_back(diffFunction(xValues[xValues.size() - 4 + i], yValues[yValues.size() - 4 + i]));
-    }
-    
-    // Continue from the 4th step to the end
-    for (int i = 4; i <= steps; ++i) {
-        if (verbose) {
-            std::cout << "\nStep " << i << ":" << std::endl;
-        }
-        
-        // Adams-Bashforth 4-step formula
-        double yNext = yValues.back() + stepSize * (
-            55.0 * fValues[3] - 
-            59.0 * fValues[2] + 
-            37.0 * fValues[1] - 
-            9.0 * fValues[0]
-        ) / 24.0;
-        
-        // Round to 4 decimal places
-        yNext = std::round(yNext * 10000.0) / 10000.0;
-        
+        out << "\n=== " << getMethodName() << " ===" << std::endl;
+        out << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0
+            << ", y0 = " << y0 << std::endl;
+        out << "Step size: h = " << stepSize << std::endl;
+        out << "Target x: " << xTarget << std::endl;
+        if (order > 1) {
+            out << "Using RK4 for first " << order << " steps" << std::endl;
+        }
+
+        for (int i = 0; i < points; ++i) {
+            out << "Initial point " << i << ": x = " << std::fixed << std::setprecision(4)
+                << startX[i] << ", y = " << startY[i] << std::endl;
+        }
+        beginTrace(mode == Mode::Explicit ? formatAdamsBashforthStep : formatAdamsMoultonStep);
+    }
+
+    // Counts the calls of the stepping loop
+    auto rhs = countCalls(diffFunction, instrumentation);
+
+    // Ring of the slopes at the last points; newest is the index of f_n
+    double slopes[HISTORY];
+    unsigned newest = 0;
+    for (int i = 0; i < points; ++i) {
+        newest = i;
+        slopes[newest] = rhs(startX[i], startY[i]);
+    }
+
+    // Continue from the last startup point to the end
+    for (int i = points; i <= steps; ++i) {
+        PhaseSample sample(instrumentation);
+
+        // Adams-Bashforth predictor
+        double yPredicted = y + predictorIncrement(order, stepSize, slopes, newest);
+        double yNext = yPredicted;
+
+        // Adams-Moulton corrector, from the slope at the predicted point
+        if (mode == Mode::PredictorCorrector) {
+            double fPredicted = rhs(x + stepSize, yPredicted);
+            yNext = y + correctorIncrement(order, stepSize, fPredicted, slopes, newest);
+        }
+
+        sample.enter(SolvePhase::Rounding);
+        // Round to 4 decimal places in classroom precision
+        yNext = PrecisionPolicy::apply(yNext);
+
         // Update x and y
         x += stepSize;
         y = yNext;
-        
+
         // Store values
-        xValues.push_back(x);
-        yValues.push_back(y);
-        
-        // Update function values
-        for (int j = 0; j < 3; ++j) {
-            fValues[j] = fValues[j + 1];
-        }
-        fValues[3] = diffFunction(x, y);
-        
+        sample.enter(SolvePhase::Storage);
+        recordStep(x, y);
+        sample.enter(SolvePhase::None);
+
+        // The new slope overwrites the oldest one
+        slopes[++newest & HISTORY_MASK] = rhs(x, y);
+
         if (verbose) {
-            std::cout << "New y = " << y << " at x = " << std::fixed << std::setprecision(4) << x << std::endl;
-            
-            if (compareExact) {
-                double exact = exactSolution(x);
-                // Round to 4 decimal places
-                exact = std::round(exact * 10000.0) / 10000.0;
-                double error = std::abs(exact - y);
-                std::cout << "Exact solution: " << exact << std::endl;
-                std::cout << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
-            }
-            
-            // Add small delay for better user experience
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            StepRecord record;
+            record.step = i;
+            record.x = x;
+            record.y = y;
+            record.increment = yPredicted;
+            record.h = stepSize;
+            traceStep(record);
         }
     }
-    
+
+    endSolve();
+    endTrace();
+
     if (verbose) {
-        std::cout << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget 
-                  << ": y = " << y << std::endl;
-        
+        out << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget
+            << ": y = " << y << std::endl;
+
         if (compareExact) {
-            double exact = exactSolution(xTarget);
+            double exact = exactFunction(xTarget);
             // Round to 4 decimal places
             exact = std::round(exact * 10000.0) / 10000.0;
             double error = std::abs(exact - y);
-            std::cout << "Exact solution: " << exact << std::endl;
-            std::cout << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
+            out << "Exact solution: " << exact << std::endl;
+            out << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
+        }
+    }
+}
+
+void AdamsBashforth::solveAdaptive() {
+    // Integrate towards xTarget whatever the sign of stepSize; h is the step length
+    const double dir = (xTarget >= x0) ? 1.0 : -1.0;
+    double x = x0;
+    double y = y0;
+    double h = std::min(std::abs(stepSize), dir * (xTarget - x0));
+    int currentOrder = MIN_ORDER;
+    int stepsAtOrder = 0;       // Accepted steps since the order last changed
+    int quietSteps = 0;         // Accepted steps in a row that a doubled step would have met
+
+    evaluations = 0;
+    acceptedSteps = 0;
+    rejectedSteps = 0;
+
+    std::ostream& out = traceStream();
+
+    beginSolve();
+
+    if (verbose) {
+        out << "\n=== " << getMethodName() << " ===" << std::endl;
+        out << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0
+            << ", y0 = " << y0 << std::endl;
+        out << "Initial step size: h = " << stepSize << std::endl;
+        tolerances.print(out);
+        out << "Target x: " << std::fixed << std::setprecision(4) << xTarget << std::endl;
+        beginTrace(formatDormandPrinceStep);
+    }
+
+    auto rhs = [this](double xVal, double yVal) {
+        ++evaluations;
+        return diffFunction(xVal, yVal);
+    };
+
+    // Slopes at equally spaced points ending at (x, y); the method starts
+    // itself at order 1 and raises the order as the history grows
+    double slopes[HISTORY];
+    unsigned newest = 0;
+    int history = 1;
+    slopes[0] = rhs(x, y);
+
+    while (dir * (xTarget - x) > 0.0) {
+        PhaseSample sample(instrumentation);
+
+        if (acceptedSteps + rejectedSteps >= MAX_STEPS) {
+            throw std::runtime_error("Adams-Bashforth-Moulton: maximum number of steps exceeded");
+        }
+        if (h <= std::abs(x) * 1e-15) {
+            throw std::runtime_error("Adams-Bashforth-Moulton: step size underflow");
+        }
+
+        // Land on the target; a shorter last step is taken with RK4
+        double remaining = dir * (xTarget - x);
+        bool lastStep = h >= remaining * (1.0 - 1e-9);
+        bool shortened = h > remaining * (1.0 + 1e-9);
+        double xStart = x;
+        double hStep = dir * (shortened ? remaining : h);
+        double errorEstimate = 0.0;
+
+        if (shortened) {
+            // RK4 step, whose first stage is the newest slope
+            double k1 = slopes[newest & HISTORY_MASK];
+            double k2 = rhs(x + 0.5 * hStep, y + 0.5 * hStep * k1);
+            double k3 = rhs(x + 0.5 * hStep, y + 0.5 * hStep * k2);
+            double k4 = rhs(x + hStep, y + hStep * k3);
+            y += hStep * (k1 + 2.0 * k2 + 2.0 * k3 + k4) / 6.0;
+        }
+        else {
+            // PECE step of the current order
+            double yPredicted = y + predictorIncrement(currentOrder, hStep, slopes, newest);
+            double fPredicted = rhs(x + hStep, yPredicted);
+            double yCorrected = y + correctorIncrement(currentOrder, hStep, fPredicted, slopes, newest);
+
+            double scale = tolerances.scale(y, yCorrected);
+            double err = milneEstimate(currentOrder, hStep, fPredicted, slopes, newest) / scale;
+
+            if (err > 1.0) {
+                // Reject and halve the step; the slopes at the halved spacing
+                // come from the polynomial through the last ones
+                ++rejectedSteps;
+                h *= 0.5;
+                double halved[MAX_ORDER];
+                for (int i = 0; i < currentOrder; ++i) {
+                    halved[i] = interpolateSlope(currentOrder, 0.5 * i, slopes, newest);
+                }
+                for (int i = 0; i < currentOrder; ++i) {
+                    slopes[(newest - i) & HISTORY_MASK] = halved[i];
+                }
+                history = currentOrder;
+                stepsAtOrder = 0;
+                quietSteps = 0;
+
+                if (verbose) {
+                    StepRecord record;
+                    record.kind = StepRecord::Rejected;
+                    record.xStart = x;
+                    record.x = x;
+                    record.y = y;
+                    record.h = dir * h;
+                    traceStep(record);
+                }
+                continue;
+            }
+
+            // Compare with the neighbouring orders, which need no extra evaluations
+            int chosenOrder = currentOrder;
+            double chosenErr = err;
+            ++stepsAtOrder;
+            if (currentOrder > 1) {
+                double lowerErr = milneEstimate(currentOrder - 1, hStep, fPredicted, slopes, newest) / scale;
+                if (lowerErr <= err) {
+                    chosenOrder = currentOrder - 1;
+                    chosenErr = lowerErr;
+                }
+            }
+            if (chosenOrder == currentOrder && currentOrder < order && history > currentOrder &&
+                stepsAtOrder > currentOrder) {
+                double higherErr = milneEstimate(currentOrder + 1, hStep, fPredicted, slopes, newest) / scale;
+                if (higherErr < err) {
+                    chosenOrder = currentOrder + 1;
+                    chosenErr = higherErr;
+                }
+            }
+            if (chosenOrder != currentOrder) {
+                currentOrder = chosenOrder;
+                stepsAtOrder = 0;
+            }
+
+            // The error of a step grows like h^(order + 1)
+            if (chosenErr * std::pow(2.0, currentOrder + 1) <= GROWTH_SAFETY) {
+                ++quietSteps;
+            }
+            else {
+                quietSteps = 0;
+            }
+
+            y = yCorrected;
+            errorEstimate = err * scale;
+        }
+
+        x = lastStep ? xTarget : x + hStep;
+        ++acceptedSteps;
+
+        // Store values
+        sample.enter(SolvePhase::Storage);
+        recordStep(x, y);
+        sample.enter(SolvePhase::None);
+
+        if (verbose) {
+            StepRecord record;
+            record.step = acceptedSteps;
+            record.xStart = xStart;
+            record.x = x;
+            record.y = y;
+            record.h = hStep;
+            record.errorEstimate = errorEstimate;
+            traceStep(record);
+        }
+
+        if (lastStep) {
+            break;
+        }
+
+        // The new slope overwrites the oldest one
+        slopes[++newest & HISTORY_MASK] = rhs(x, y);
+        ++history;
+
+        // Double the step once it has been small for a while, keeping every
+        // other slope, which are then equally spaced by the doubled step
+        if (quietSteps > currentOrder && history >= 2 * currentOrder - 1) {
+            for (int i = 1; i < currentOrder; ++i) {
+                slopes[(newest - i) & HISTORY_MASK] = slopes[(newest - 2 * i) & HISTORY_MASK];
+            }
+            h *= 2.0;
+            history = currentOrder;
+            quietSteps = 0;
+        }
+    }
+
+    steps = acceptedSteps;
+
+    // Every evaluation is already counted above
+    instrumentation.countCalls(evaluations);
+    endSolve();
+    endTrace();
+
+    if (verbose) {
+        out << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget
+            << ": y = " << y << std::endl;
+        out << "Accepted steps: " << acceptedSteps << ", rejected steps: " << rejectedSteps
+            << ", function evaluations: " << evaluations << std::endl;
+
+        if (compareExact) {
+            double exact = exactFunction(xTarget);
+            double error = std::abs(exact - y);
+            out << "Exact solution: " << exact << std::endl;
+            out << "Error: " << std::scientific << std::setprecision(2) << error << std::endl;
+            out << std::fixed << std::setprecision(4);
         }
     }
 }
 
+void AdamsBashforth::solveSystem() {
+    if (mode == Mode::Adaptive) {
+        throw std::runtime_error("The adaptive Adams-Bashforth-Moulton method supports only single "
+                                 "equations; use the Explicit or PredictorCorrector mode for systems");
+    }
+
+    checkSystemReady();
+    const size_t n = dimension;
+    const double halfStep = 0.5 * stepSize;
+    const int points = startupPoints();
+
+    // State, the ring of slope rows and the RK4 stage buffers, from the
+    // reused workspace
+    Workspace& work = solveWorkspace();
+    double* y = work.allocate(n);
+    double* f = work.allocate(HISTORY * n);
+    double* k2 = work.allocate(3 * n);
+    double* k3 = k2 + n;
+    double* k4 = k3 + n;
+    double* yStage = work.allocate(n);
+    auto slopeRow = [f, n](unsigned index) { return f + (index & HISTORY_MASK) * n; };
+
+    auto rhs = countCalls(systemFunction, instrumentation);
+    beginSolve();
+
+    // Use RK4 for the startup points, as in the scalar solver; the slope
+    // at each point is its k1
+    std::copy(initialState.begin(), initialState.end(), y);
+    double x = x0;
+    unsigned newest = 0;
+    for (int i = 0; i < points; ++i) {
+        newest = i;
+        rhs(x, y, slopeRow(newest));
+        if (i + 1 == points) {
+            break;
+        }
+
+        const double* k1 = slopeRow(newest);
+        addScaled(n, y, halfStep, k1, yStage);
+        rhs(x + halfStep, yStage, k2);
+        addScaled(n, y, halfStep, k2, yStage);
+        rhs(x + halfStep, yStage, k3);
+        addScaled(n, y, stepSize, k3, yStage);
+        rhs(x + stepSize, yStage, k4);
+
+        for (size_t j = 0; j < n; ++j) {
+            y[j] += stepSize * (k1[j] + 2.0 * k2[j] + 2.0 * k3[j] + k4[j]) / 6.0;
+        }
+        x += stepSize;
+
+        storeState(x, y);
+    }
+
+    const double* abWeights = AB_WEIGHTS[order - 1];
+    const double* amWeights = AM_WEIGHTS[order - 1];
+    double* yPredicted = yStage;
+    double* fPredicted = k2;
+
+    for (int i = points; i <= steps; ++i) {
+        // Adams-Bashforth predictor
+        for (size_t j = 0; j < n; ++j) {
+            double sum = abWeights[0] * slopeRow(newest)[j];
+            for (int m = 1; m < order; ++m) {
+                sum += abWeights[m] * slopeRow(newest - m)[j];
+            }
+            yPredicted[j] = y[j] + stepSize * sum / AB_DENOMINATORS[order - 1];
+        }
+
+        // Adams-Moulton corrector
+        if (mode == Mode::PredictorCorrector) {
+            rhs(x + stepSize, yPredicted, fPredicted);
+            for (size_t j = 0; j < n; ++j) {
+                double sum = amWeights[0] * fPredicted[j];
+                for (int m = 1; m < order; ++m) {
+                    sum += amWeights[m] * slopeRow(newest - (m - 1))[j];
+                }
+                y[j] += stepSize * sum / AM_DENOMINATORS[order - 1];
+            }
+        }
+        else {
+            std::copy(yPredicted, yPredicted + n, y);
+        }
+        x += stepSize;
+
+        storeState(x, y);
+
+        // The new slope row overwrites the oldest one
+        rhs(x, y, slopeRow(++newest));
+    }
+
+    printSystemSummary();
+    endSolve();
+}
+
+int AdamsBashforth::getOrder() const {
+    return order;
+}
+
+AdamsBashforth::Mode AdamsBashforth::getMode() const {
+    return mode;
+}
+
+long AdamsBashforth::getFunctionEvaluations() const {
+    return evaluations;
+}
+
+int AdamsBashforth::getAcceptedSteps() const {
+    return acceptedSteps;
+}
+
+int AdamsBashforth::getRejectedSteps() const {
+    return rejectedSteps;
+}
+
 std::string AdamsBashforth::getMethodName() const {
-    return "Adams-Bashforth Method";
-}
\ No newline at end of file
+    std::string orderText = std::to_string(order);
+    switch (mode) {
+        case Mode::PredictorCorrector:
+            return "Adams-Bashforth-Moulton Method (order " + orderText + ")";
+        case Mode::Adaptive:
+            return "Adaptive Adams-Bashforth-Moulton Method (orders 1-" + orderText + ")";
+        default:
+            return order == 4 ? "Adams-Bashforth Method" : "Adams-Bashforth Method (order " + orderText + ")";
+    }
+}
@@ -0,0 +1,278 @@
+/**
+ * @file BDF.cpp
+ * @brief Implementation of the variable-order BDF method
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "BDF.h"
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+// Weights of y_n, y_{n-1}, ... in the formulas of orders 1 to 5
+const double ALPHA[5][5] = {
+    { 1.0 },
+    { 4.0 / 3.0, -1.0 / 3.0 },
+    { 18.0 / 11.0, -9.0 / 11.0, 2.0 / 11.0 },
+    { 48.0 / 25.0, -36.0 / 25.0, 16.0 / 25.0, -3.0 / 25.0 },
+    { 300.0 / 137.0, -300.0 / 137.0, 200.0 / 137.0, -75.0 / 137.0, 12.0 / 137.0 }
+};
+
+// Weight of h * f_{n+1}
+const double BETA[5] = { 1.0, 2.0 / 3.0, 6.0 / 11.0, 12.0 / 25.0, 60.0 / 137.0 };
+
+// Past points kept; a power of 2 with room for the k + 3 points of an order increase
+const unsigned HISTORY = 8;
+const unsigned HISTORY_MASK = HISTORY - 1;
+
+// Step size control
+const double SAFETY = 0.9;
+const double MIN_FACTOR = 0.2;
+const double MAX_FACTOR = 5.0;
+const double GROWTH_THRESHOLD = 1.2;        // Smaller increases keep the LU factors
+const double NEWTON_FAILURE_FACTOR = 0.25;
+const int MAX_STEPS = 10000000;
+
+double binomial(int n, int k) {
+    double value = 1.0;
+    for (int i = 1; i <= k; ++i) {
+        value = value * (n - k + i) / i;
+    }
+    return value;
+}
+
+// Lagrange basis polynomial of node i of the nodes 0 .. count - 1, at t
+double lagrangeWeight(int i, int count, double t) {
+    double weight = 1.0;
+    for (int m = 0; m < count; ++m) {
+        if (m != i) {
+            weight *= (t - m) / (i - m);
+        }
+    }
+    return weight;
+}
+
+} // namespace
+
+BDF::BDF(std::function<double(double, double)> diffFunc, int maxOrderVal)
+    : ImplicitMethod(diffFunc), maxOrder(maxOrderVal) {
+    if (maxOrderVal < MIN_ORDER || maxOrderVal > MAX_ORDER) {
+        throw std::invalid_argument("BDF methods are available for orders 1 to 5");
+    }
+    adaptive = true;
+}
+
+void BDF::integrate(double* y) {
+    // Integrate towards xTarget whatever the sign of stepSize
+    const double dir = (xTarget >= x0) ? 1.0 : -1.0;
+    double x = x0;
+    double h = dir * std::min(std::abs(stepSize), dir * (xTarget - x0));
+    advance(x, y, h, stepBuffers());
+}
+
+BDF::StepBuffers BDF::stepBuffers() {
+    const size_t n = size;
+    StepBuffers work;
+    work.history = scratch(HISTORY * n);
+    work.moved = scratch((MAX_ORDER + 1) * n);
+    work.psi = scratch(n);
+    work.yNew = scratch(n);
+    work.predicted = scratch(n);
+    work.slope = scratch(n);
+    work.difference = scratch(n);
+    return work;
+}
+
+bool BDF::stopAfterStep(double, const double*, double) {
+    return false;
+}
+
+void BDF::advance(double& x, double* y, double& h, const StepBuffers& work) {
+    const size_t n = size;
+
+    // Ring of the past points, newest first, equally spaced by h
+    double* history = work.history;
+    double* moved = work.moved;
+    double* psi = work.psi;
+    double* yNew = work.yNew;
+    double* predicted = work.predicted;
+    double* slope = work.slope;
+    double* difference = work.difference;
+    auto row = [history, n](unsigned i) { return history + (i & HISTORY_MASK) * n; };
+
+    int order = MIN_ORDER;
+    int count = 1;              // Points in the history
+    int stepsSinceChange = 0;   // Steps since the last change of order or step size
+    unsigned newest = 0;
+    std::copy(y, y + n, row(newest));
+
+    // Slope at x0 for the Euler predictor of the first step
+    evaluate(x, y, slope);
+
+    // Move the points to ratio times the current spacing, through the
+    // polynomial of the last order + 1 points
+    auto changeStep = [&](double ratio) {
+        int points = std::min(count, order + 1);
+        for (int j = 1; j < points; ++j) {
+            double* target = moved + j * n;
+            std::fill(target, target + n, 0.0);
+            for (int i = 0; i < points; ++i) {
+                double weight = lagrangeWeight(i, points, j * ratio);
+                const double* source = row(newest - i);
+                for (size_t c = 0; c < n; ++c) {
+                    target[c] += weight * source[c];
+                }
+            }
+        }
+        for (int j = 1; j < points; ++j) {
+            std::copy(moved + j * n, moved + (j + 1) * n, row(newest - j));
+        }
+        count = points;
+        h *= ratio;
+        stepsSinceChange = 0;
+    };
+
+    // Scaled norm of the m-th backward difference at the newest point
+    auto differenceNorm = [&](int m) {
+        std::fill(difference, difference + n, 0.0);
+        for (int i = 0; i <= m; ++i) {
+            double weight = ((i % 2 == 0) ? 1.0 : -1.0) * binomial(m, i);
+            const double* source = row(newest - i);
+            for (size_t c = 0; c < n; ++c) {
+                difference[c] += weight * source[c];
+            }
+        }
+        return tolerances.scaledNorm(n, difference, row(newest - 1), row(newest));
+    };
+
+    // h carries the direction of integration; lengths are compared with dir * h
+    const double dir = (h >= 0.0) ? 1.0 : -1.0;
+
+    while (dir * (xTarget - x) > 0.0) {
+        PhaseSample sample(instrumentation);
+
+        if (acceptedSteps + rejectedSteps >= MAX_STEPS) {
+            throw std::runtime_error("BDF: maximum number of steps exceeded");
+        }
+        if (dir * h <= std::abs(x) * 1e-15) {
+            throw std::runtime_error("BDF: step size underflow");
+        }
+
+        // Do not step past the target
+        double remaining = dir * (xTarget - x);
+        bool lastStep = dir * h >= remaining * (1.0 - 1e-9);
+        if (dir * h > remaining * (1.0 + 1e-9)) {
+            changeStep(remaining / (dir * h));
+        }
+        const double* yOld = row(newest);
+
+        // Predictor: extrapolate the last order + 1 points, or Euler at the start
+        for (size_t c = 0; c < n; ++c) {
+            if (count == 1) {
+                predicted[c] = yOld[c] + h * slope[c];
+                continue;
+            }
+            double sum = 0.0;
+            for (int j = 0; j <= order; ++j) {
+                sum += ((j % 2 == 0) ? 1.0 : -1.0) * binomial(order + 1, j + 1) * row(newest - j)[c];
+            }
+            predicted[c] = sum;
+        }
+
+        // Corrector: y = psi + b * h * f(x_{n+1}, y) by Newton's method
+        for (size_t c = 0; c < n; ++c) {
+            double sum = 0.0;
+            for (int j = 0; j < order; ++j) {
+                sum += ALPHA[order - 1][j] * row(newest - j)[c];
+            }
+            psi[c] = sum;
+        }
+        std::copy(predicted, predicted + n, yNew);
+
+        double xNew = lastStep ? xTarget : x + h;
+        if (!newtonSolve(xNew, psi, BETA[order - 1] * h, yNew)) {
+            ++rejectedSteps;
+            changeStep(NEWTON_FAILURE_FACTOR);
+            traceRejected(x, yOld, h);
+            continue;
+        }
+
+        // Local error from the predictor-corrector difference
+        for (size_t c = 0; c < n; ++c) {
+            difference[c] = yNew[c] - predicted[c];
+        }
+        double errorFactor = BETA[order - 1] / (order + 1);
+        double err = errorFactor * tolerances.scaledNorm(n, difference, yOld, yNew);
+
+        if (err > 1.0) {
+            ++rejectedSteps;
+            changeStep(std::max(MIN_FACTOR, SAFETY * std::pow(err, -1.0 / (order + 1))));
+            traceRejected(x, yOld, h);
+            continue;
+        }
+
+        double errorEstimate = errorFactor * std::abs(difference[0]);
+        std::copy(yNew, yNew + n, row(++newest));
+        count = std::min(count + 1, static_cast<int>(HISTORY));
+        double xStart = x;
+        x = xNew;
+
+        sample.enter(SolvePhase::Storage);
+        acceptStep(xStart, x, yNew, h, errorEstimate);
+        sample.enter(SolvePhase::None);
+
+        if (lastStep || stopAfterStep(x, yNew, h)) {
+            break;
+        }
+
+        // After order + 1 steps of the same size, pick the order allowing
+        // the largest step; lower orders are slightly preferred
+        if (++stepsSinceChange <= order) {
+            continue;
+        }
+        double bestFactor = 1.0 / (1.2 * std::pow(std::max(err, 1e-10), 1.0 / (order + 1)));
+        int bestOrder = order;
+        if (order > MIN_ORDER) {
+            double errLower = BETA[order - 2] / order * differenceNorm(order);
+            double factor = 1.0 / (1.3 * std::pow(std::max(errLower, 1e-10), 1.0 / order));
+            if (factor > bestFactor) {
+                bestFactor = factor;
+                bestOrder = order - 1;
+            }
+        }
+        if (order < maxOrder && count >= order + 3) {
+            double errHigher = BETA[order] / (order + 2) * differenceNorm(order + 2);
+            double factor = 1.0 / (1.4 * std::pow(std::max(errHigher, 1e-10), 1.0 / (order + 2)));
+            if (factor > bestFactor) {
+                bestFactor = factor;
+                bestOrder = order + 1;
+            }
+        }
+
+        if (bestOrder != order) {
+            order = bestOrder;
+            stepsSinceChange = 0;
+        }
+        bestFactor = std::min(MAX_FACTOR, bestFactor);
+        if (bestFactor >= GROWTH_THRESHOLD) {
+            changeStep(bestFactor);
+        }
+    }
+
+    std::copy(row(newest), row(newest) + n, y);
+}
+
+StepFormatter BDF::stepFormatter() const {
+    return formatDormandPrinceStep;
+}
+
+int BDF::getMaxOrder() const {
+    return maxOrder;
+}
+
+std::string BDF::getMethodName() const {
+    return "BDF Method (orders 1-" + std::to_string(maxOrder) + ")";
+}
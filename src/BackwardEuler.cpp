@@ -0,0 +1,23 @@
+/**
+ * @file BackwardEuler.cpp
+ * @brief Implementation of the backward Euler method
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "BackwardEuler.h"
+
+BackwardEuler::BackwardEuler(std::function<double(double, double)> diffFunc)
+    : ImplicitMethod(diffFunc) {}
+
+void BackwardEuler::integrate(double* y) {
+    integrateTheta(y, 1.0);
+}
+
+StepFormatter BackwardEuler::stepFormatter() const {
+    return formatEulerStep;
+}
+
+std::string BackwardEuler::getMethodName() const {
+    return "Backward Euler Method";
+}
@@ -0,0 +1,296 @@
+/**
+ * @file BatchRunner.cpp
+ * @brief Implementation of the batch runner
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "BatchRunner.h"
+#include "CsvWriter.h"
+#include "Expression.h"
+#include "NumericalMethod.h"
+#include "Plugin.h"
+#include "StepObserver.h"
+#include "ThreadPool.h"
+#include "Utility.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+// Parse a whole token as a number
+double parseNumber(const std::string& text, const std::string& where) {
+    char* end = NULL;
+    double value = std::strtod(text.c_str(), &end);
+    if (text.empty() || *end != '\0') {
+        throw std::invalid_argument(where + ": not a number: " + text);
+    }
+    return value;
+}
+
+} // namespace
+
+BatchRunner::BatchRunner(unsigned threadCount) : threads(threadCount), wallTime(0.0) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+void BatchRunner::addJob(const BatchJob& job) {
+    jobs.push_back(job);
+}
+
+void BatchRunner::loadJobFile(const std::string& filename) {
+    std::ifstream file(filename.c_str());
+    if (!file) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        std::istringstream fields(line);
+        std::string field;
+        if (!(fields >> field) || field[0] == '#') {
+            continue;
+        }
+
+        std::string where = filename + ":" + std::to_string(lineNumber);
+        BatchJob job;
+        do {
+            size_t equals = field.find('=');
+            if (equals == std::string::npos) {
+                throw std::invalid_argument(where + ": expected key=value, got " + field);
+            }
+            std::string key = field.substr(0, equals);
+            std::string value = field.substr(equals + 1);
+
+            if (key == "name") {
+                job.name = value;
+            }
+            else if (key == "method") {
+                job.method = value;
+            }
+            else if (key == "equation") {
+                job.equation = value;
+            }
+            else if (key == "solution") {
+                job.solution = value;
+            }
+            else if (key == "plugin") {
+                job.plugin = value;
+            }
+            else if (key == "x0") {
+                job.x0 = parseNumber(value, where);
+            }
+            else if (key == "y0") {
+                job.y0 = parseNumber(value, where);
+            }
+            else if (key == "xTarget") {
+                job.xTarget = parseNumber(value, where);
+            }
+            else if (key == "h") {
+                job.stepSize = parseNumber(value, where);
+            }
+            else if (key == "exact") {
+                job.compareExact = parseNumber(value, where) != 0.0;
+            }
+            else if (key == "csv") {
+                job.csvFile = value;
+            }
+            else if (key == "binary") {
+                job.binaryFile = value;
+            }
+            else {
+                throw std::invalid_argument(where + ": unknown key " + key);
+            }
+        } while (fields >> field);
+
+        jobs.push_back(job);
+    }
+}
+
+const std::vector<BatchJob>& BatchRunner::getJobs() const {
+    return jobs;
+}
+
+void BatchRunner::solveJob(size_t index) {
+    const BatchJob& job = jobs[index];
+    BatchResult& result = results[index];
+    result.name = job.name.empty() ? std::to_string(index + 1) : job.name;
+    result.finalX = std::numeric_limits<double>::quiet_NaN();
+    result.finalY = std::numeric_limits<double>::quiet_NaN();
+    result.error = std::numeric_limits<double>::quiet_NaN();
+
+    auto start = std::chrono::steady_clock::now();
+    try {
+        if (!(std::abs(job.stepSize) > 0.0) || std::isinf(job.stepSize)) {
+            throw std::invalid_argument("Step size must be finite and nonzero");
+        }
+
+        if (!job.plugin.empty() && !job.equation.empty()) {
+            throw std::invalid_argument("A job takes an equation or a plugin, not both");
+        }
+
+        // The built-in exact solution belongs to the built-in equation
+        if (job.compareExact && !job.equation.empty() && job.solution.empty()) {
+            throw std::invalid_argument("Comparing an equation with the exact solution needs a solution");
+        }
+
+        // Declared before the method, so the library is closed after it
+        std::unique_ptr<Plugin> plugin;
+        std::unique_ptr<NumericalMethod> method;
+        if (!job.plugin.empty()) {
+            plugin.reset(new Plugin(job.plugin));
+            if (job.compareExact && job.solution.empty() && !plugin->hasExactSolution()) {
+                throw std::invalid_argument("Comparing a plugin with the exact solution needs a solution; "
+                                            "the plugin exports none");
+            }
+            method.reset(plugin->createMethod(job.method));
+        }
+        else if (!job.equation.empty()) {
+            method.reset(Utility::createMethod(job.method, Expression(job.equation)));
+        }
+        else {
+            method.reset(Utility::createMethod(job.method));
+        }
+        result.methodName = method->getMethodName();
+        method->setVerbose(false);
+        method->setCompareExact(job.compareExact);
+        if (!job.solution.empty()) {
+            Expression solution(job.solution);
+            if (solution.usesY()) {
+                throw std::invalid_argument("The exact solution must depend on x only: " + job.solution);
+            }
+            method->setExactSolution([solution](double x) { return solution(x, 0.0); });
+        }
+
+        // Keep no steps unless a trajectory is written
+        std::shared_ptr<FinalValueObserver> finalValue;
+        if (job.csvFile.empty() && job.binaryFile.empty()) {
+            finalValue = std::make_shared<FinalValueObserver>();
+            method->setObserver(finalValue);
+        }
+
+        method->setParameters(job.x0, job.y0, job.xTarget, job.stepSize);
+        method->solve();
+        result.finalX = finalValue ? finalValue->getX() : method->getXValues().back();
+        result.finalY = method->getResult();
+        if (job.compareExact) {
+            result.error = std::abs(method->exactAt(result.finalX) - result.finalY);
+        }
+
+        if (!job.csvFile.empty()) {
+            method->saveToCSV(job.csvFile);
+        }
+        if (!job.binaryFile.empty()) {
+            method->saveToBinary(job.binaryFile);
+        }
+    }
+    catch (const std::exception& e) {
+        result.message = e.what();
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+const std::vector<BatchResult>& BatchRunner::run() {
+    results.assign(jobs.size(), BatchResult());
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        ThreadPool pool(static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(jobs.size(), 1))));
+        std::vector<std::future<void> > pending;
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            pending.push_back(pool.submit([this, i]() { solveJob(i); }));
+        }
+        for (size_t i = 0; i < pending.size(); ++i) {
+            pending[i].get();
+        }
+    }
+    wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return results;
+}
+
+const std::vector<BatchResult>& BatchRunner::getResults() const {
+    return results;
+}
+
+size_t BatchRunner::getFailureCount() const {
+    size_t failures = 0;
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (!results[i].message.empty()) {
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+double BatchRunner::getWallTime() const {
+    return wallTime;
+}
+
+void BatchRunner::printSummary(std::ostream& out) const {
+    // Widen the method column for long method names
+    size_t methodWidth = 30;
+    for (size_t i = 0; i < results.size(); ++i) {
+        methodWidth = std::max(methodWidth, results[i].methodName.size() + 2);
+    }
+
+    out << std::left << std::setw(16) << "Job"
+        << std::setw(methodWidth) << "Method"
+        << std::setw(12) << "Final x"
+        << std::setw(16) << "Final y"
+        << std::setw(12) << "Error"
+        << std::setw(12) << "Time (ms)"
+        << "Status" << std::endl;
+    out << std::string(74 + methodWidth, '-') << std::endl;
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BatchResult& r = results[i];
+        out << std::left << std::setw(16) << r.name
+            << std::setw(methodWidth) << (r.methodName.empty() ? jobs[i].method : r.methodName)
+            << std::fixed << std::setprecision(4)
+            << std::setw(12) << r.finalX
+            << std::setw(16) << r.finalY
+            << std::scientific << std::setprecision(2)
+            << std::setw(12) << r.error
+            << std::fixed << std::setprecision(3)
+            << std::setw(12) << r.seconds * 1000.0
+            << (r.message.empty() ? "ok" : r.message) << std::endl;
+    }
+
+    out << "\n" << results.size() << " jobs, " << getFailureCount() << " failed, "
+        << std::fixed << std::setprecision(3) << wallTime << " s" << std::endl;
+}
+
+void BatchRunner::saveToCSV(const std::string& filename) const {
+    std::FILE* file = std::fopen(filename.c_str(), "w");
+    if (file == NULL) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+
+    std::fprintf(file, "name,method,finalX,finalY,error,seconds,message\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BatchResult& r = results[i];
+        std::fprintf(file, "%s,%s,%.17g,%.17g,%.17g,%.9g,%s\n",
+                     CsvWriter::quote(r.name).c_str(), CsvWriter::quote(r.methodName).c_str(), r.finalX,
+                     r.finalY, r.error, r.seconds, CsvWriter::quote(r.message).c_str());
+    }
+
+    if (std::fclose(file) != 0) {
+        throw std::runtime_error("Failed to write file: " + filename);
+    }
+}
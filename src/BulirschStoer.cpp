@@ -0,0 +1,328 @@
+/**
+ * @file BulirschStoer.cpp
+ * @brief Implementation of the Gragg-Bulirsch-Stoer extrapolation method
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "BulirschStoer.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+// Substeps of the midpoint rule in each column (the sequence 2, 4, 6, ...)
+int substeps(int column) {
+    return 2 * (column + 1);
+}
+
+// Step size control (Hairer, Norsett & Wanner, ODEX)
+const double SAFETY = 0.94;
+const double ERROR_SAFETY = 0.65;
+const double MIN_FACTOR = 0.02;
+const double MAX_FACTOR = 4.0;
+const double LOWER_WORK = 0.8;      // Lower the order if it costs less than this per unit step
+const double HIGHER_WORK = 0.9;     // Raise the order if it costs less than this per unit step
+const int MIN_TARGET = 2;           // Lowest target column
+const int MAX_STEPS = 10000000;
+
+} // namespace
+
+BulirschStoer::BulirschStoer(std::function<double(double, double)> diffFunc)
+    : NumericalMethod(diffFunc), evaluations(0),
+      acceptedSteps(0), rejectedSteps(0), systemSolve(false), size(1), buffers(NULL) {
+}
+
+void BulirschStoer::setTolerances(double absTol, double relTol) {
+    tolerances.set(absTol, relTol);
+}
+
+void BulirschStoer::solve() {
+    systemSolve = false;
+    size = 1;
+
+    std::ostream& out = traceStream();
+
+    beginSolve();
+
+    if (verbose) {
+        out << "\n=== " << getMethodName() << " ===" << std::endl;
+        out << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0
+            << ", y0 = " << y0 << std::endl;
+        out << "Initial step size: h = " << stepSize << std::endl;
+        tolerances.print(out);
+        out << "Target x: " << std::fixed << std::setprecision(4) << xTarget << std::endl;
+        beginTrace(formatDormandPrinceStep);
+    }
+
+    buffers = &solveWorkspace();
+    double* y = buffers->allocate(1);
+    y[0] = y0;
+    integrate(y);
+
+    // Every evaluation is already counted
+    instrumentation.countCalls(evaluations);
+    endSolve();
+    endTrace();
+
+    if (verbose) {
+        out << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget
+            << ": y = " << getResult() << std::endl;
+        out << "Accepted steps: " << acceptedSteps << ", rejected steps: " << rejectedSteps
+            << ", function evaluations: " << evaluations << std::endl;
+
+        if (compareExact) {
+            double exact = exactFunction(xTarget);
+            double error = std::abs(exact - getResult());
+            out << "Exact solution: " << exact << std::endl;
+            out << "Error: " << std::scientific << std::setprecision(2) << error << std::endl;
+            out << std::fixed << std::setprecision(4);
+        }
+    }
+}
+
+void BulirschStoer::solveSystem() {
+    checkSystemReady();
+    systemSolve = true;
+    size = dimension;
+
+    beginSolve();
+    buffers = &solveWorkspace();
+    double* y = buffers->allocate(size);
+    std::copy(initialState.begin(), initialState.end(), y);
+    integrate(y);
+    instrumentation.countCalls(evaluations);
+    printSystemSummary();
+    endSolve();
+}
+
+void BulirschStoer::evaluate(double x, const double* y, double* dydx) {
+    ++evaluations;
+    evaluateRhs(systemSolve, x, y, dydx);
+}
+
+void BulirschStoer::midpoint(double x, const double* y, const double* f0, double bigStep, int count,
+                             double* result, double* previous, double* current, double* slope) {
+    const size_t n = size;
+    double h = bigStep / count;
+
+    // z_1 = z_0 + h * f(x, z_0)
+    for (size_t i = 0; i < n; ++i) {
+        previous[i] = y[i];
+        current[i] = y[i] + h * f0[i];
+    }
+
+    // z_{m+1} = z_{m-1} + 2h * f(x + m h, z_m)
+    for (int m = 1; m < count; ++m) {
+        evaluate(x + m * h, current, slope);
+        for (size_t i = 0; i < n; ++i) {
+            double next = previous[i] + 2.0 * h * slope[i];
+            previous[i] = current[i];
+            current[i] = next;
+        }
+    }
+
+    // Gragg's smoothing of the end value
+    evaluate(x + bigStep, current, slope);
+    for (size_t i = 0; i < n; ++i) {
+        result[i] = 0.5 * (current[i] + previous[i] + h * slope[i]);
+    }
+}
+
+void BulirschStoer::integrate(double* y) {
+    const size_t n = size;
+    evaluations = 0;
+    acceptedSteps = 0;
+    rejectedSteps = 0;
+
+    // Scratch buffers, from the reused workspace
+    double* row = buffers->allocate(MAX_COLUMNS * n);       // Row j of the table, column k at k * n
+    double* lastRow = buffers->allocate(MAX_COLUMNS * n);   // Row j - 1
+    double* f0 = buffers->allocate(n);
+    double* previous = buffers->allocate(n);
+    double* current = buffers->allocate(n);
+    double* slope = buffers->allocate(n);
+    double* difference = buffers->allocate(n);
+
+    // Cost of the columns up to k, and the step factor and work per unit step of column k
+    double cost[MAX_COLUMNS];
+    double factors[MAX_COLUMNS];
+    double work[MAX_COLUMNS];
+    cost[0] = 1.0 + substeps(0);
+    for (int k = 1; k < MAX_COLUMNS; ++k) {
+        cost[k] = cost[k - 1] + substeps(k);
+    }
+
+    // Higher orders for tighter tolerances
+    double tolerance = std::max(tolerances.relative, 1e-40);
+    int target = static_cast<int>(-std::log10(tolerance) * 0.6 + 1.5);
+    target = std::max(MIN_TARGET, std::min(MAX_COLUMNS - 2, target));
+
+    // Integrate towards xTarget whatever the sign of stepSize; h keeps that
+    // direction, and step lengths are compared with dir * h
+    const double dir = (xTarget >= x0) ? 1.0 : -1.0;
+    double x = x0;
+    double h = dir * std::min(std::abs(stepSize), dir * (xTarget - x0));
+    bool lastRejected = false;
+
+    evaluate(x, y, f0);
+
+    while (dir * (xTarget - x) > 0.0) {
+        PhaseSample sample(instrumentation);
+
+        if (acceptedSteps + rejectedSteps >= MAX_STEPS) {
+            throw std::runtime_error("Bulirsch-Stoer: maximum number of steps exceeded");
+        }
+
+        // Do not step past the target
+        bool lastStep = false;
+        if (dir * h >= dir * (xTarget - x)) {
+            h = xTarget - x;
+            lastStep = true;
+        }
+        if (dir * h <= std::abs(x) * 1e-15) {
+            throw std::runtime_error("Bulirsch-Stoer: step size underflow");
+        }
+
+        // Build the table row by row up to one column past the target
+        int column = -1;        // Column accepted, -1 if none
+        int last = 0;           // Last column built
+        double err = 0.0;
+        for (int j = 0; j <= target + 1; ++j) {
+            last = j;
+            std::swap(row, lastRow);
+            midpoint(x, y, f0, h, substeps(j), row, previous, current, slope);
+
+            // Aitken-Neville extrapolation in the square of the substep
+            for (int k = 1; k <= j; ++k) {
+                double ratio = static_cast<double>(substeps(j)) / substeps(j - k);
+                double denominator = ratio * ratio - 1.0;
+                for (size_t i = 0; i < n; ++i) {
+                    double value = row[(k - 1) * n + i];
+                    row[k * n + i] = value + (value - lastRow[(k - 1) * n + i]) / denominator;
+                }
+            }
+            if (j == 0) {
+                continue;
+            }
+
+            for (size_t i = 0; i < n; ++i) {
+                difference[i] = row[j * n + i] - row[(j - 1) * n + i];
+            }
+            err = tolerances.scaledNorm(n, difference, y, row + j * n);
+            if (!std::isfinite(err)) {
+                factors[j] = MIN_FACTOR;
+                break;
+            }
+            double factor = SAFETY * std::pow(ERROR_SAFETY / std::max(err, 1e-300), 1.0 / (2 * j + 1));
+            factors[j] = std::min(MAX_FACTOR, std::max(MIN_FACTOR, factor));
+            work[j] = cost[j] / factors[j];
+
+            if (j < target - 1) {
+                continue;
+            }
+            if (err <= 1.0) {
+                column = j;
+                break;
+            }
+
+            // Give up early when the remaining columns are unlikely to converge
+            double reach = static_cast<double>(substeps(target + 1)) / substeps(0);
+            if (j == target - 1) {
+                reach *= static_cast<double>(substeps(target)) / substeps(0);
+            }
+            if (j < target + 1 && err > reach * reach) {
+                break;
+            }
+        }
+
+        if (column < 0) {
+            // Reject the step and retry with a smaller one and at most the same order
+            ++rejectedSteps;
+            lastRejected = true;
+            target = std::max(MIN_TARGET, std::min(target, last));
+            h *= (last >= 1) ? std::min(factors[last], 0.5) : MIN_FACTOR;
+
+            if (verbose && !systemSolve) {
+                StepRecord record;
+                record.kind = StepRecord::Rejected;
+                record.xStart = x;
+                record.x = x;
+                record.y = y[0];
+                record.h = h;
+                traceStep(record);
+            }
+            continue;
+        }
+
+        double xStart = x;
+        x = lastStep ? xTarget : x + h;
+        std::copy(row + column * n, row + (column + 1) * n, y);
+        ++acceptedSteps;
+
+        sample.enter(SolvePhase::Storage);
+        if (systemSolve) {
+            storeState(x, y);
+        }
+        else {
+            recordStep(x, y[0]);
+            if (verbose) {
+                StepRecord record;
+                record.step = acceptedSteps;
+                record.xStart = xStart;
+                record.x = x;
+                record.y = y[0];
+                record.h = h;
+                record.errorEstimate = std::abs(difference[0]);
+                traceStep(record);
+            }
+        }
+        sample.enter(SolvePhase::None);
+
+        if (lastStep) {
+            break;
+        }
+        evaluate(x, y, f0);
+
+        // Next target column: the one with the least work per unit step
+        int next = column;
+        if (column >= 2 && work[column - 1] < LOWER_WORK * work[column]) {
+            next = column - 1;
+        }
+        else if (column >= target && column >= 2 && !lastRejected
+                 && work[column] < HIGHER_WORK * work[column - 1]) {
+            next = column + 1;
+        }
+        next = std::max(MIN_TARGET, std::min(MAX_COLUMNS - 2, next));
+
+        double growth = (next <= column) ? factors[next]
+                                         : factors[column] * cost[next] / cost[column];
+        if (lastRejected) {
+            growth = std::min(1.0, growth);
+        }
+        h *= std::min(MAX_FACTOR, growth);
+        target = next;
+        lastRejected = false;
+    }
+
+    steps = acceptedSteps;
+}
+
+long BulirschStoer::getFunctionEvaluations() const {
+    return evaluations;
+}
+
+int BulirschStoer::getAcceptedSteps() const {
+    return acceptedSteps;
+}
+
+int BulirschStoer::getRejectedSteps() const {
+    return rejectedSteps;
+}
+
+std::string BulirschStoer::getMethodName() const {
+    return "Bulirsch-Stoer Method";
+}
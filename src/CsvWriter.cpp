@@ -0,0 +1,251 @@
+/**
+ * @file CsvWriter.cpp
+ * @brief Implementation of the buffered CSV exporter
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "CsvWriter.h"
+#include <cstdio>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <thread>
+#include <exception>
+#include <algorithm>
+#include <stdint.h>
+
+namespace {
+
+// Rows formatted by one task
+const size_t CHUNK_ROWS = 1 << 15;
+
+// Largest magnitude handled by the integer path. Below it, value * 10000
+// is off by less than 2e-5 units of the last digit...
+const double FAST_LIMIT = 1e7;
+
+// ...so only fractions this close to a tie need the exact decimal expansion
+const double TIE_BAND = 1e-4;
+
+char* formatUnsigned(uint64_t value, char* out) {
+    char digits[24];
+    int n = 0;
+    do {
+        digits[n++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    while (n > 0) {
+        *out++ = digits[--n];
+    }
+    return out;
+}
+
+// Format rows [begin, end) into text; exact holds the exact solution at every x, or is NULL
+void formatRows(std::string& text, const double* x, const double* y, size_t begin, size_t end,
+                size_t dimension, const double* exact) {
+    char field[CsvWriter::MAX_FIXED4_LENGTH + 2];
+    text.clear();
+    text.reserve((end - begin) * (24 + 12 * dimension + (exact != NULL ? 24 : 0)));
+
+    for (size_t i = begin; i < end; ++i) {
+        char* p = formatUnsigned(i, field);
+        text.append(field, p);
+
+        // Every value is preceded by a comma
+        field[0] = ',';
+        p = CsvWriter::formatFixed4(x[i], field + 1);
+        text.append(field, p);
+
+        const double* state = y + i * dimension;
+        for (size_t j = 0; j < dimension; ++j) {
+            p = CsvWriter::formatFixed4(state[j], field + 1);
+            text.append(field, p);
+        }
+
+        if (exact != NULL) {
+            double exactValue = exact[i];
+            double error = std::abs(exactValue - state[0]);
+            p = CsvWriter::formatFixed4(exactValue, field + 1);
+            text.append(field, p);
+            p = CsvWriter::formatFixed4(error, field + 1);
+            text.append(field, p);
+        }
+
+        text.push_back('\n');
+    }
+}
+
+// Worker body: an exception escaping a thread would call std::terminate,
+// so it is kept for the calling thread to rethrow
+void formatChunk(std::exception_ptr& error, std::string& text, const double* x, const double* y,
+                 size_t begin, size_t end, size_t dimension, const double* exact) {
+    try {
+        formatRows(text, x, y, begin, end, dimension, exact);
+    }
+    catch (...) {
+        error = std::current_exception();
+    }
+}
+
+// Joins the threads of a batch however the batch is left
+struct JoinGuard {
+    std::vector<std::thread>& pool;
+
+    explicit JoinGuard(std::vector<std::thread>& threads) : pool(threads) {}
+
+    ~JoinGuard() {
+        for (size_t t = 0; t < pool.size(); ++t) {
+            if (pool[t].joinable()) {
+                pool[t].join();
+            }
+        }
+    }
+};
+
+// Closes the file unless released
+struct FileGuard {
+    std::FILE* file;
+
+    explicit FileGuard(std::FILE* f) : file(f) {}
+
+    ~FileGuard() {
+        if (file != NULL) {
+            std::fclose(file);
+        }
+    }
+
+    std::FILE* release() {
+        std::FILE* f = file;
+        file = NULL;
+        return f;
+    }
+};
+
+void writeText(std::FILE* file, const std::string& text, const std::string& filename) {
+    if (!text.empty() && std::fwrite(text.data(), 1, text.size(), file) != text.size()) {
+        throw std::runtime_error("Failed to write file: " + filename);
+    }
+}
+
+} // namespace
+
+char* CsvWriter::formatFixed4(double value, char* out) {
+    double scaled = std::abs(value) * 10000.0;
+    double whole = std::floor(scaled);
+    double fraction = scaled - whole;
+
+    if (!(std::abs(value) < FAST_LIMIT) || std::abs(fraction - 0.5) < TIE_BAND) {
+        int n = std::snprintf(out, CsvWriter::MAX_FIXED4_LENGTH + 1, "%.4f", value);
+        return out + n;
+    }
+
+    uint64_t units = static_cast<uint64_t>(whole) + (fraction > 0.5 ? 1 : 0);
+    if (std::signbit(value)) {
+        *out++ = '-';
+    }
+    out = formatUnsigned(units / 10000, out);
+    *out++ = '.';
+
+    unsigned decimals = static_cast<unsigned>(units % 10000);
+    out[0] = static_cast<char>('0' + decimals / 1000);
+    out[1] = static_cast<char>('0' + decimals / 100 % 10);
+    out[2] = static_cast<char>('0' + decimals / 10 % 10);
+    out[3] = static_cast<char>('0' + decimals % 10);
+    return out + 4;
+}
+
+std::string CsvWriter::quote(const std::string& field) {
+    std::string quoted = "\"";
+    for (size_t i = 0; i < field.size(); ++i) {
+        if (field[i] == '"') {
+            quoted += '"';
+        }
+        quoted += field[i];
+    }
+    quoted += '"';
+    return quoted;
+}
+
+void CsvWriter::write(const std::string& filename, const double* x, const double* y,
+                      size_t count, size_t dimension,
+                      const std::function<double(double)>& exact, unsigned threads) {
+    // The exact solution may keep state, so it is called here only,
+    // not from the formatting threads
+    std::vector<double> exactValues;
+    if (exact) {
+        exactValues.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            exactValues[i] = exact(x[i]);
+        }
+    }
+    const double* exactColumn = exact ? exactValues.data() : NULL;
+
+    FileGuard guard(std::fopen(filename.c_str(), "wb"));
+    std::FILE* file = guard.file;
+    if (file == NULL) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+
+    // Chunks are already large; skip the stdio buffer
+    std::setvbuf(file, NULL, _IONBF, 0);
+
+    // Header
+    std::string header = "Step,x";
+    if (dimension == 1) {
+        header += ",y";
+    }
+    else {
+        for (size_t j = 0; j < dimension; ++j) {
+            header += ",y" + std::to_string(j);
+        }
+    }
+    if (exact) {
+        header += ",exact,error";
+    }
+    header += "\n";
+    writeText(file, header, filename);
+
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    size_t chunks = (count + CHUNK_ROWS - 1) / CHUNK_ROWS;
+    size_t workers = std::min<size_t>(threads, chunks);
+
+    // Format a batch of consecutive chunks in parallel, then write them in order
+    std::vector<std::string> texts(std::max<size_t>(workers, 1));
+    std::vector<std::exception_ptr> errors(texts.size());
+    for (size_t first = 0; first < chunks; first += texts.size()) {
+        size_t batch = std::min(texts.size(), chunks - first);
+        std::vector<std::thread> pool;
+        pool.reserve(batch);
+
+        {
+            JoinGuard join(pool);
+            for (size_t t = 0; t < batch; ++t) {
+                size_t begin = (first + t) * CHUNK_ROWS;
+                size_t end = std::min(count, begin + CHUNK_ROWS);
+                if (t + 1 == batch) {
+                    formatRows(texts[t], x, y, begin, end, dimension, exactColumn);
+                }
+                else {
+                    pool.push_back(std::thread(formatChunk, std::ref(errors[t]), std::ref(texts[t]),
+                                               x, y, begin, end, dimension, exactColumn));
+                }
+            }
+        }
+        for (size_t t = 0; t < batch; ++t) {
+            if (errors[t]) {
+                std::rethrow_exception(errors[t]);
+            }
+        }
+        for (size_t t = 0; t < batch; ++t) {
+            writeText(file, texts[t], filename);
+        }
+    }
+
+    if (std::fclose(guard.release()) != 0) {
+        throw std::runtime_error("Failed to write file: " + filename);
+    }
+}
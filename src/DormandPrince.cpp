@@ -0,0 +1,284 @@
+/**
+ * @file DormandPrince.cpp
+ * @brief Implementation of the adaptive Dormand-Prince 5(4) method
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "DormandPrince.h"
+#include "DormandPrinceTableau.h"
+#include "StaticSolver.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+const double DormandPrinceTableau::C[6] = { 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0 };
+const double DormandPrinceTableau::A[6][6] = {
+    { 1.0 / 5.0 },
+    { 3.0 / 40.0, 9.0 / 40.0 },
+    { 44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0 },
+    { 19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0 },
+    { 9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0 },
+    { 35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0 }
+};
+const double DormandPrinceTableau::E[7] = { 71.0 / 57600.0, 0.0, -71.0 / 16695.0, 71.0 / 1920.0,
+                                            -17253.0 / 339200.0, 22.0 / 525.0, -1.0 / 40.0 };
+
+const double DormandPrinceTableau::SAFETY = 0.9;
+const double DormandPrinceTableau::BETA = 0.04;
+const double DormandPrinceTableau::ALPHA = 0.2 - 0.75 * 0.04;     // 0.2 - 0.75 * BETA
+const double DormandPrinceTableau::MIN_FACTOR = 0.2;
+const double DormandPrinceTableau::MAX_FACTOR = 10.0;
+const int DormandPrinceTableau::MAX_STEPS;
+
+namespace {
+
+// The tableau and controller under short names
+const double (&C)[6] = DormandPrinceTableau::C;
+const double (&A)[6][6] = DormandPrinceTableau::A;
+const double (&E)[7] = DormandPrinceTableau::E;
+const double& SAFETY = DormandPrinceTableau::SAFETY;
+const double& ALPHA = DormandPrinceTableau::ALPHA;
+const double& BETA = DormandPrinceTableau::BETA;
+const double& MIN_FACTOR = DormandPrinceTableau::MIN_FACTOR;
+const double& MAX_FACTOR = DormandPrinceTableau::MAX_FACTOR;
+const int MAX_STEPS = DormandPrinceTableau::MAX_STEPS;
+
+// Dense output weights (Hairer, Norsett & Wanner, dopri5)
+const double D1 = -12715105075.0 / 11282082432.0, D3 = 87487479700.0 / 32700410799.0,
+             D4 = -10690763975.0 / 1880347072.0, D5 = 701980252875.0 / 199316789632.0,
+             D6 = -1453857185.0 / 822651844.0, D7 = 69997945.0 / 29380423.0;
+
+} // namespace
+
+DormandPrince45::DormandPrince45(std::function<double(double, double)> diffFunc)
+    : NumericalMethod(diffFunc), evaluations(0), acceptedSteps(0), rejectedSteps(0) {
+    // Coefficients of the 4th order interpolant of each step
+    denseStride = 4;
+}
+
+void DormandPrince45::setTolerances(double absTol, double relTol) {
+    tolerances.set(absTol, relTol);
+}
+
+void DormandPrince45::solve() {
+    double x = x0;
+    double y = y0;
+    // Integrate towards xTarget whatever the sign of stepSize; h is the step length
+    const double dir = (xTarget >= x0) ? 1.0 : -1.0;
+    double h = std::min(std::abs(stepSize), dir * (xTarget - x0));
+    double errOld = 1e-4;
+    bool lastRejected = false;
+
+    evaluations = 0;
+    acceptedSteps = 0;
+    rejectedSteps = 0;
+
+    std::ostream& out = traceStream();
+
+    beginSolve();
+
+    if (verbose) {
+        out << "\n=== Dormand-Prince 5(4) Method ===" << std::endl;
+        out << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0
+            << ", y0 = " << y0 << std::endl;
+        out << "Initial step size: h = " << stepSize << std::endl;
+        tolerances.print(out);
+        out << "Target x: " << std::fixed << std::setprecision(4) << xTarget << std::endl;
+        beginTrace(formatDormandPrinceStep);
+    }
+
+    // First stage, reused from the previous accepted step afterwards (FSAL)
+    double k1 = diffFunction(x, y);
+    ++evaluations;
+
+    while (dir * (xTarget - x) > 0.0) {
+        PhaseSample sample(instrumentation);
+
+        if (acceptedSteps + rejectedSteps >= MAX_STEPS) {
+            throw std::runtime_error("Dormand-Prince: maximum number of steps exceeded");
+        }
+
+        // Do not step past the target
+        bool lastStep = false;
+        if (h >= dir * (xTarget - x)) {
+            h = dir * (xTarget - x);
+            lastStep = true;
+        }
+        if (h <= std::abs(x) * 1e-15) {
+            throw std::runtime_error("Dormand-Prince: step size underflow");
+        }
+        const double step = dir * h;
+
+        double k2 = diffFunction(x + C[0] * step, y + step * A[0][0] * k1);
+        double k3 = diffFunction(x + C[1] * step, y + step * (A[1][0] * k1 + A[1][1] * k2));
+        double k4 = diffFunction(x + C[2] * step, y + step * (A[2][0] * k1 + A[2][1] * k2 + A[2][2] * k3));
+        double k5 = diffFunction(x + C[3] * step,
+                                 y + step * (A[3][0] * k1 + A[3][1] * k2 + A[3][2] * k3 + A[3][3] * k4));
+        double k6 = diffFunction(x + step,
+                                 y + step * (A[4][0] * k1 + A[4][1] * k2 + A[4][2] * k3 + A[4][3] * k4
+                                             + A[4][4] * k5));
+        double yNew = y + step * (A[5][0] * k1 + A[5][2] * k3 + A[5][3] * k4 + A[5][4] * k5 + A[5][5] * k6);
+        double k7 = diffFunction(x + step, yNew);
+        evaluations += 6;
+
+        // Scaled error estimate of the embedded 4th order solution
+        double scale = tolerances.scale(y, yNew);
+        double err = std::abs(step * (E[0] * k1 + E[2] * k3 + E[3] * k4 + E[4] * k5 + E[5] * k6 + E[6] * k7))
+                     / scale;
+
+        // PI step-size controller
+        double errFactor = std::pow(std::max(err, 1e-10), ALPHA);
+
+        if (err <= 1.0) {
+            double factor = SAFETY / (errFactor * std::pow(errOld, -BETA));
+            factor = std::min(MAX_FACTOR, std::max(MIN_FACTOR, factor));
+            if (lastRejected) {
+                factor = std::min(1.0, factor);
+            }
+            errOld = std::max(err, 1e-4);
+            lastRejected = false;
+
+            if (denseOutput) {
+                double yDiff = yNew - y;
+                double bSpline = step * k1 - yDiff;
+                denseValues.push_back(yDiff);
+                denseValues.push_back(bSpline);
+                denseValues.push_back(yDiff - step * k7 - bSpline);
+                denseValues.push_back(step * (D1 * k1 + D3 * k3 + D4 * k4 + D5 * k5 + D6 * k6 + D7 * k7));
+            }
+
+            double xStart = x;
+            x = lastStep ? xTarget : x + step;
+            y = yNew;
+            k1 = k7;
+            ++acceptedSteps;
+
+            // Store values
+            sample.enter(SolvePhase::Storage);
+            recordStep(x, y);
+            sample.enter(SolvePhase::None);
+
+            if (verbose) {
+                StepRecord record;
+                record.step = acceptedSteps;
+                record.xStart = xStart;
+                record.x = x;
+                record.y = y;
+                record.h = step;
+                record.errorEstimate = err * scale;
+                traceStep(record);
+            }
+
+            h *= factor;
+        }
+        else {
+            // Reject the step and retry with a smaller one
+            ++rejectedSteps;
+            lastRejected = true;
+            h *= std::max(MIN_FACTOR, SAFETY / errFactor);
+
+            if (verbose) {
+                StepRecord record;
+                record.kind = StepRecord::Rejected;
+                record.xStart = x;
+                record.x = x;
+                record.y = y;
+                record.h = dir * h;
+                traceStep(record);
+            }
+        }
+    }
+
+    steps = acceptedSteps;
+
+    // Every evaluation is already counted above
+    instrumentation.countCalls(evaluations);
+    endSolve();
+    endTrace();
+
+    if (verbose) {
+        out << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget
+            << ": y = " << y << std::endl;
+        out << "Accepted steps: " << acceptedSteps << ", rejected steps: " << rejectedSteps
+            << ", function evaluations: " << evaluations << std::endl;
+
+        if (compareExact) {
+            double exact = exactFunction(xTarget);
+            double error = std::abs(exact - y);
+            out << "Exact solution: " << exact << std::endl;
+            out << "Error: " << std::scientific << std::setprecision(2) << error << std::endl;
+            out << std::fixed << std::setprecision(4);
+        }
+    }
+}
+
+long DormandPrince45::getFunctionEvaluations() const {
+    return evaluations;
+}
+
+int DormandPrince45::getAcceptedSteps() const {
+    return acceptedSteps;
+}
+
+int DormandPrince45::getRejectedSteps() const {
+    return rejectedSteps;
+}
+
+long DormandPrince45::reportSavings() const {
+    double targetError = calculateError();
+
+    // Full-precision RK4, so that its error is not floored by rounding
+    StaticSolver<RungeKutta4Stepper, std::function<double(double, double)> > rk4(diffFunction);
+    int rkSteps = std::max(1, static_cast<int>(std::abs((xTarget - x0) / stepSize) + 0.5));
+    const int maxSteps = 1 << 24;
+    double rkError = 0.0;
+
+    for (; rkSteps <= maxSteps; rkSteps *= 2) {
+        std::vector<double> xs, ys;
+        rk4.solve(x0, y0, xTarget, (xTarget - x0) / rkSteps, xs, ys);
+
+        rkError = 0.0;
+        for (size_t i = 0; i < xs.size(); ++i) {
+            rkError = std::max(rkError, std::abs(exactFunction(xs[i]) - ys[i]));
+        }
+        if (rkError <= targetError) {
+            break;
+        }
+    }
+
+    std::cout << "\n=== Function Evaluations at Equal Accuracy ===" << std::endl;
+    std::cout << "Dormand-Prince 5(4): " << evaluations << " evaluations, max error "
+              << std::scientific << std::setprecision(2) << targetError << std::endl;
+
+    if (rkSteps > maxSteps) {
+        std::cout << "4th Order Runge-Kutta did not reach this accuracy within "
+                  << maxSteps << " steps" << std::endl;
+        std::cout << std::fixed << std::setprecision(4);
+        return -1;
+    }
+
+    long rkEvaluations = 4L * rkSteps;
+    long saved = rkEvaluations - evaluations;
+    std::cout << "4th Order Runge-Kutta: " << rkEvaluations << " evaluations (" << rkSteps
+              << " steps), max error " << rkError << std::endl;
+    std::cout << "Evaluations saved: " << saved << std::endl;
+    std::cout << std::fixed << std::setprecision(4);
+    return saved;
+}
+
+double DormandPrince45::interpolateStep(size_t i, double theta) const {
+    if (denseValues.size() < (i + 1) * denseStride) {
+        return NumericalMethod::interpolateStep(i, theta);
+    }
+
+    const double* r = &denseValues[i * denseStride];
+    double theta1 = 1.0 - theta;
+    return yValues[i] + theta * (r[0] + theta1 * (r[1] + theta * (r[2] + theta1 * r[3])));
+}
+
+std::string DormandPrince45::getMethodName() const {
+    return "Dormand-Prince 5(4) Method";
+}
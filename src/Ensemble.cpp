@@ -0,0 +1,324 @@
+/**
+ * @file Ensemble.cpp
+ * @brief Implementation of the SIMD ensemble solver
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "Ensemble.h"
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ENSEMBLE_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Members advanced together before moving to the next block; sized so the
+// state and stage arrays of one block stay in cache.
+const size_t BLOCK_SIZE = 1024;
+
+// Number of arrays of BLOCK_SIZE doubles used by solveBlock
+const size_t WORK_ARRAYS = 6;
+
+/**
+ * @brief Lane kernels used by the schemes
+ *
+ * offset:      out[i] = y[i] + a * k[i]
+ * shift:       out[i] = x[i] + a
+ * accumulate2: y[i] += a * (k1[i] + k2[i])
+ * accumulate4: y[i] += a * (k1[i] + 2 * k2[i] + 2 * k3[i] + k4[i])
+ */
+struct KernelSet {
+    const char* name;
+    void (*offset)(size_t n, const double* y, double a, const double* k, double* out);
+    void (*shift)(size_t n, const double* x, double a, double* out);
+    void (*accumulate2)(size_t n, double* y, double a, const double* k1, const double* k2);
+    void (*accumulate4)(size_t n, double* y, double a, const double* k1, const double* k2,
+                        const double* k3, const double* k4);
+};
+
+void offsetScalar(size_t n, const double* y, double a, const double* k, double* out) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = y[i] + a * k[i];
+    }
+}
+
+void shiftScalar(size_t n, const double* x, double a, double* out) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = x[i] + a;
+    }
+}
+
+void accumulate2Scalar(size_t n, double* y, double a, const double* k1, const double* k2) {
+    for (size_t i = 0; i < n; ++i) {
+        y[i] += a * (k1[i] + k2[i]);
+    }
+}
+
+void accumulate4Scalar(size_t n, double* y, double a, const double* k1, const double* k2,
+                       const double* k3, const double* k4) {
+    for (size_t i = 0; i < n; ++i) {
+        y[i] += a * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    }
+}
+
+#ifdef ENSEMBLE_X86_KERNELS
+
+__attribute__((target("avx2,fma")))
+void offsetAvx2(size_t n, const double* y, double a, const double* k, double* out) {
+    const __m256d va = _mm256_set1_pd(a);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_fmadd_pd(va, _mm256_loadu_pd(k + i), _mm256_loadu_pd(y + i)));
+    }
+    offsetScalar(n - i, y + i, a, k + i, out + i);
+}
+
+__attribute__((target("avx2,fma")))
+void shiftAvx2(size_t n, const double* x, double a, double* out) {
+    const __m256d va = _mm256_set1_pd(a);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_loadu_pd(x + i), va));
+    }
+    shiftScalar(n - i, x + i, a, out + i);
+}
+
+__attribute__((target("avx2,fma")))
+void accumulate2Avx2(size_t n, double* y, double a, const double* k1, const double* k2) {
+    const __m256d va = _mm256_set1_pd(a);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d sum = _mm256_add_pd(_mm256_loadu_pd(k1 + i), _mm256_loadu_pd(k2 + i));
+        _mm256_storeu_pd(y + i, _mm256_fmadd_pd(va, sum, _mm256_loadu_pd(y + i)));
+    }
+    accumulate2Scalar(n - i, y + i, a, k1 + i, k2 + i);
+}
+
+__attribute__((target("avx2,fma")))
+void accumulate4Avx2(size_t n, double* y, double a, const double* k1, const double* k2,
+                     const double* k3, const double* k4) {
+    const __m256d va = _mm256_set1_pd(a);
+    const __m256d two = _mm256_set1_pd(2.0);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d inner = _mm256_add_pd(_mm256_loadu_pd(k2 + i), _mm256_loadu_pd(k3 + i));
+        __m256d outer = _mm256_add_pd(_mm256_loadu_pd(k1 + i), _mm256_loadu_pd(k4 + i));
+        __m256d sum = _mm256_fmadd_pd(two, inner, outer);
+        _mm256_storeu_pd(y + i, _mm256_fmadd_pd(va, sum, _mm256_loadu_pd(y + i)));
+    }
+    accumulate4Scalar(n - i, y + i, a, k1 + i, k2 + i, k3 + i, k4 + i);
+}
+
+__attribute__((target("avx512f")))
+void offsetAvx512(size_t n, const double* y, double a, const double* k, double* out) {
+    const __m512d va = _mm512_set1_pd(a);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_fmadd_pd(va, _mm512_loadu_pd(k + i), _mm512_loadu_pd(y + i)));
+    }
+    offsetScalar(n - i, y + i, a, k + i, out + i);
+}
+
+__attribute__((target("avx512f")))
+void shiftAvx512(size_t n, const double* x, double a, double* out) {
+    const __m512d va = _mm512_set1_pd(a);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(out + i, _mm512_add_pd(_mm512_loadu_pd(x + i), va));
+    }
+    shiftScalar(n - i, x + i, a, out + i);
+}
+
+__attribute__((target("avx512f")))
+void accumulate2Avx512(size_t n, double* y, double a, const double* k1, const double* k2) {
+    const __m512d va = _mm512_set1_pd(a);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d sum = _mm512_add_pd(_mm512_loadu_pd(k1 + i), _mm512_loadu_pd(k2 + i));
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(va, sum, _mm512_loadu_pd(y + i)));
+    }
+    accumulate2Scalar(n - i, y + i, a, k1 + i, k2 + i);
+}
+
+__attribute__((target("avx512f")))
+void accumulate4Avx512(size_t n, double* y, double a, const double* k1, const double* k2,
+                       const double* k3, const double* k4) {
+    const __m512d va = _mm512_set1_pd(a);
+    const __m512d two = _mm512_set1_pd(2.0);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d inner = _mm512_add_pd(_mm512_loadu_pd(k2 + i), _mm512_loadu_pd(k3 + i));
+        __m512d outer = _mm512_add_pd(_mm512_loadu_pd(k1 + i), _mm512_loadu_pd(k4 + i));
+        __m512d sum = _mm512_fmadd_pd(two, inner, outer);
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(va, sum, _mm512_loadu_pd(y + i)));
+    }
+    accumulate4Scalar(n - i, y + i, a, k1 + i, k2 + i, k3 + i, k4 + i);
+}
+
+#endif // ENSEMBLE_X86_KERNELS
+
+// Kernel sets this CPU can run, fastest first; scalar is always last
+std::vector<KernelSet> detectKernels() {
+    std::vector<KernelSet> available;
+#ifdef ENSEMBLE_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        KernelSet kernels = { "avx512", offsetAvx512, shiftAvx512, accumulate2Avx512, accumulate4Avx512 };
+        available.push_back(kernels);
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        KernelSet kernels = { "avx2", offsetAvx2, shiftAvx2, accumulate2Avx2, accumulate4Avx2 };
+        available.push_back(kernels);
+    }
+#endif
+    KernelSet kernels = { "scalar", offsetScalar, shiftScalar, accumulate2Scalar, accumulate4Scalar };
+    available.push_back(kernels);
+    return available;
+}
+
+// Detected once, on first use (thread-safe static initialization)
+const std::vector<KernelSet>& availableKernels() {
+    static const std::vector<KernelSet> detected = detectKernels();
+    return detected;
+}
+
+} // namespace
+
+EnsembleSolver::EnsembleSolver(Scheme schemeVal, BatchFunction batchFunc)
+    : scheme(schemeVal), batchFunction(batchFunc), kernel(-1), stepSize(0.0), steps(0) {}
+
+void EnsembleSolver::setParameters(const std::vector<double>& x0Vals, const std::vector<double>& y0Vals,
+                                   double interval, double stepSizeVal) {
+    if (x0Vals.size() != y0Vals.size()) {
+        throw std::invalid_argument("x0 and y0 must have one value per ensemble member");
+    }
+
+    stepSize = stepSizeVal;
+
+    // Calculate number of steps
+    steps = static_cast<int>(interval / stepSize + 0.5);
+
+    xValues = x0Vals;
+    yValues = y0Vals;
+}
+
+void EnsembleSolver::solve() {
+    // Stage buffers for one block, shared by all blocks and solves
+    workspace.clear();
+    double* work = workspace.allocate(WORK_ARRAYS * BLOCK_SIZE);
+
+    for (size_t begin = 0; begin < xValues.size(); begin += BLOCK_SIZE) {
+        size_t count = std::min(BLOCK_SIZE, xValues.size() - begin);
+        solveBlock(begin, count, work);
+    }
+}
+
+void EnsembleSolver::solveBlock(size_t begin, size_t count, double* work) {
+    const KernelSet& k = availableKernels()[std::max(kernel, 0)];
+    const double h = stepSize;
+    const double halfStep = 0.5 * h;
+
+    double* x = &xValues[begin];
+    double* y = &yValues[begin];
+    double* xStage = work;
+    double* yStage = xStage + BLOCK_SIZE;
+    double* k1 = yStage + BLOCK_SIZE;
+    double* k2 = k1 + BLOCK_SIZE;
+    double* k3 = k2 + BLOCK_SIZE;
+    double* k4 = k3 + BLOCK_SIZE;
+
+    for (int i = 0; i < steps; ++i) {
+        switch (scheme) {
+            case Scheme::Euler:
+                batchFunction(count, x, y, k1);
+                k.offset(count, y, h, k1, y);
+                break;
+
+            case Scheme::ModifiedEuler:
+            case Scheme::RungeKutta2:
+                // Heun's predictor-corrector and RK2 share the same tableau
+                batchFunction(count, x, y, k1);
+                k.shift(count, x, h, xStage);
+                k.offset(count, y, h, k1, yStage);
+                batchFunction(count, xStage, yStage, k2);
+                k.accumulate2(count, y, halfStep, k1, k2);
+                break;
+
+            case Scheme::RungeKutta4:
+                batchFunction(count, x, y, k1);
+                k.shift(count, x, halfStep, xStage);
+                k.offset(count, y, halfStep, k1, yStage);
+                batchFunction(count, xStage, yStage, k2);
+                k.offset(count, y, halfStep, k2, yStage);
+                batchFunction(count, xStage, yStage, k3);
+                k.shift(count, x, h, xStage);
+                k.offset(count, y, h, k3, yStage);
+                batchFunction(count, xStage, yStage, k4);
+                k.accumulate4(count, y, h / 6.0, k1, k2, k3, k4);
+                break;
+        }
+
+        k.shift(count, x, h, x);
+    }
+}
+
+const std::vector<double>& EnsembleSolver::getXValues() const {
+    return xValues;
+}
+
+const std::vector<double>& EnsembleSolver::getYValues() const {
+    return yValues;
+}
+
+size_t EnsembleSolver::size() const {
+    return xValues.size();
+}
+
+std::string EnsembleSolver::getMethodName() const {
+    switch (scheme) {
+        case Scheme::Euler:
+            return "Euler's Method (ensemble)";
+        case Scheme::ModifiedEuler:
+            return "Modified Euler's Method (ensemble)";
+        case Scheme::RungeKutta2:
+            return "2nd Order Runge-Kutta Method (ensemble)";
+        case Scheme::RungeKutta4:
+            return "4th Order Runge-Kutta Method (ensemble)";
+    }
+    return "Ensemble";
+}
+
+const char* EnsembleSolver::getKernelName() {
+    return availableKernels().front().name;
+}
+
+std::vector<std::string> EnsembleSolver::getAvailableKernels() {
+    std::vector<std::string> names;
+    for (size_t i = 0; i < availableKernels().size(); ++i) {
+        names.push_back(availableKernels()[i].name);
+    }
+    return names;
+}
+
+void EnsembleSolver::setKernel(const std::string& name) {
+    if (name == "auto") {
+        kernel = -1;
+        return;
+    }
+    const std::vector<KernelSet>& available = availableKernels();
+    for (size_t i = 0; i < available.size(); ++i) {
+        if (name == available[i].name) {
+            kernel = static_cast<int>(i);
+            return;
+        }
+    }
+    throw std::invalid_argument("Ensemble kernel not available on this CPU: " + name);
+}
+
+const char* EnsembleSolver::getKernel() const {
+    return availableKernels()[std::max(kernel, 0)].name;
+}
@@ -6,10 +6,12 @@
  */
 
 #include "Euler.h"
+#include "StaticSolver.h"
+#include "PrecisionPolicy.h"
 #include <iostream>
 #include <iomanip>
-#include <chrono>
-#include <thread>
+#include <cmath>
+#include <algorithm>
 
 EulersMethod::EulersMethod(std::function<double(double, double)> diffFunc) 
     : NumericalMethod(diffFunc) {}
@@ -19,62 +21,95 @@ void EulersMethod::solve() {
     double x = x0;
     double y = y0;
     
+    std::ostream& out = traceStream();
+    
+    beginSolve();
+    
     if (verbose) {
-        std::cout << "\n=== Euler's Method ===" << std::endl;
-        std::cout << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0 
-                  << ", y0 = " << y0 << std::endl;
-        std::cout << "Step size: h = " << stepSize << std::endl;
-        std::cout << "Target x: " << xTarget << std::endl;
+        out << "\n=== Euler's Method ===" << std::endl;
+        out << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0 
+            << ", y0 = " << y0 << std::endl;
+        out << "Step size: h = " << stepSize << std::endl;
+        out << "Target x: " << xTarget << std::endl;
+        beginTrace(formatEulerStep);
     }
     
+    double slope[EulerStepper::stages];
+    
+    // Counts the calls the stepper makes
+    auto rhs = countCalls(diffFunction, instrumentation);
+    
     // Solve step by step
     for (int i = 0; i < steps; ++i) {
+        PhaseSample sample(instrumentation);
+        
         // Calculate next values using Euler's formula: y_{n+1} = y_n + h * f(x_n, y_n)
-        double slope = diffFunction(x, y);
+        double increment = EulerStepper::step(rhs, x, y, stepSize, slope);
         x += stepSize;
-        y += stepSize * slope;
+        y += increment;
         
-        // Round to 4 decimal places
-        y = std::round(y * 10000.0) / 10000.0;
+        sample.enter(SolvePhase::Rounding);
+        // Round to 4 decimal places in classroom precision
+        y = PrecisionPolicy::apply(y);
         
         // Store values
-        xValues.push_back(x);
-        yValues.push_back(y);
+        sample.enter(SolvePhase::Storage);
+        recordStep(x, y);
+        sample.enter(SolvePhase::None);
         
         if (verbose) {
-            std::cout << "\nStep " << (i + 1) << ":" << std::endl;
-            std::cout << "x = " << std::fixed << std::setprecision(4) << x 
-                      << ", y = " << y << std::endl;
-            
-            if (compareExact) {
-                double exact = exactSolution(x);
-                // Round to 4 decimal places
-                exact = std::round(exact * 10000.0) / 10000.0;
-                double error = std::abs(exact - y);
-                std::cout << "Exact solution: " << exact << std::endl;
-                std::cout << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
-            }
-            
-            // Add small delay for better user experience
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            StepRecord record;
+            record.step = i + 1;
+            record.x = x;
+            record.y = y;
+            traceStep(record);
         }
     }
     
+    endSolve();
+    endTrace();
+    
     if (verbose) {
-        std::cout << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget 
-                  << ": y = " << y << std::endl;
+        out << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget 
+            << ": y = " << y << std::endl;
         
         if (compareExact) {
-            double exact = exactSolution(xTarget);
+            double exact = exactFunction(xTarget);
             // Round to 4 decimal places
             exact = std::round(exact * 10000.0) / 10000.0;
             double error = std::abs(exact - y);
-            std::cout << "Exact solution: " << exact << std::endl;
-            std::cout << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
+            out << "Exact solution: " << exact << std::endl;
+            out << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
         }
     }
 }
 
+void EulersMethod::solveSystem() {
+    checkSystemReady();
+    const size_t n = dimension;
+    
+    // Current state and slope buffers, from the reused workspace
+    double* y = solveWorkspace().allocate(2 * n);
+    double* slope = y + n;
+    
+    std::copy(initialState.begin(), initialState.end(), y);
+    double x = x0;
+    
+    auto rhs = countCalls(systemFunction, instrumentation);
+    beginSolve();
+    for (int i = 0; i < steps; ++i) {
+        // y_{n+1} = y_n + h * F(x_n, y_n)
+        rhs(x, y, slope);
+        addScaled(n, y, stepSize, slope, y);
+        x += stepSize;
+        
+        storeState(x, y);
+    }
+    
+    printSystemSummary();
+    endSolve();
+}
+
 std::string EulersMethod::getMethodName() const {
     return "Euler's Method";
 }
\ No newline at end of file
@@ -0,0 +1,630 @@
+/**
+ * @file Expression.cpp
+ * @brief Implementation of the expression parser, simplifier and bytecode interpreter
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "Expression.h"
+#include <cmath>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+// Operations of the bytecode; unary operations read only register a
+enum OpCode {
+    OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_POW, OP_ATAN2, OP_MIN, OP_MAX,
+    OP_NEG, OP_SQUARE, OP_SIN, OP_COS, OP_TAN, OP_ASIN, OP_ACOS, OP_ATAN,
+    OP_SINH, OP_COSH, OP_TANH, OP_EXP, OP_LOG, OP_LOG10, OP_SQRT, OP_ABS
+};
+
+const char* const MNEMONICS[] = {
+    "add", "sub", "mul", "div", "pow", "atan2", "min", "max",
+    "neg", "square", "sin", "cos", "tan", "asin", "acos", "atan",
+    "sinh", "cosh", "tanh", "exp", "log", "log10", "sqrt", "abs"
+};
+
+struct FunctionInfo {
+    const char* name;
+    OpCode op;
+    int arity;
+};
+
+const FunctionInfo FUNCTIONS[] = {
+    { "sin", OP_SIN, 1 }, { "cos", OP_COS, 1 }, { "tan", OP_TAN, 1 },
+    { "asin", OP_ASIN, 1 }, { "acos", OP_ACOS, 1 }, { "atan", OP_ATAN, 1 },
+    { "sinh", OP_SINH, 1 }, { "cosh", OP_COSH, 1 }, { "tanh", OP_TANH, 1 },
+    { "exp", OP_EXP, 1 }, { "log", OP_LOG, 1 }, { "ln", OP_LOG, 1 }, { "log10", OP_LOG10, 1 },
+    { "sqrt", OP_SQRT, 1 }, { "abs", OP_ABS, 1 },
+    { "pow", OP_POW, 2 }, { "atan2", OP_ATAN2, 2 }, { "min", OP_MIN, 2 }, { "max", OP_MAX, 2 }
+};
+
+const double PI = 3.14159265358979323846;
+const double E = 2.71828182845904523536;
+
+// Doubles of the register file of a batch evaluation, on the stack
+const size_t BATCH_DOUBLES = 4096;
+const size_t MAX_BLOCK = 64;
+
+bool isUnary(int op) {
+    return op >= OP_NEG;
+}
+
+bool isCommutative(int op) {
+    return op == OP_ADD || op == OP_MUL || op == OP_MIN || op == OP_MAX;
+}
+
+double apply(int op, double a, double b) {
+    switch (op) {
+    case OP_ADD: return a + b;
+    case OP_SUB: return a - b;
+    case OP_MUL: return a * b;
+    case OP_DIV: return a / b;
+    case OP_POW: return std::pow(a, b);
+    case OP_ATAN2: return std::atan2(a, b);
+    case OP_MIN: return std::min(a, b);
+    case OP_MAX: return std::max(a, b);
+    case OP_NEG: return -a;
+    case OP_SQUARE: return a * a;
+    case OP_SIN: return std::sin(a);
+    case OP_COS: return std::cos(a);
+    case OP_TAN: return std::tan(a);
+    case OP_ASIN: return std::asin(a);
+    case OP_ACOS: return std::acos(a);
+    case OP_ATAN: return std::atan(a);
+    case OP_SINH: return std::sinh(a);
+    case OP_COSH: return std::cosh(a);
+    case OP_TANH: return std::tanh(a);
+    case OP_EXP: return std::exp(a);
+    case OP_LOG: return std::log(a);
+    case OP_LOG10: return std::log10(a);
+    case OP_SQRT: return std::sqrt(a);
+    case OP_ABS: return std::abs(a);
+    }
+    return 0.0;
+}
+
+// Run one instruction over a block of points
+template <typename Op>
+void applyBlock(double* d, const double* a, const double* b, size_t count, Op op) {
+    for (size_t i = 0; i < count; ++i) {
+        d[i] = op(a[i], b[i]);
+    }
+}
+
+/**
+ * @brief Expression DAG whose constructors fold and simplify
+ *
+ * Equal nodes are created only once, so a repeated subexpression is one
+ * node used several times.
+ */
+class Builder {
+public:
+    enum Kind { CONSTANT, VARIABLE_X, VARIABLE_Y, OPERATION };
+
+    struct Node {
+        Kind kind;
+        int op;
+        double value;
+        int a;
+        int b;
+    };
+
+    std::vector<Node> nodes;
+
+    int constant(double value) {
+        return intern(CONSTANT, -1, value, -1, -1);
+    }
+
+    int variable(Kind kind) {
+        return intern(kind, -1, 0.0, -1, -1);
+    }
+
+    int unary(int op, int a) {
+        if (isConstant(a)) {
+            return constant(apply(op, nodes[a].value, 0.0));
+        }
+        if (op == OP_NEG && isOperation(a, OP_NEG)) {
+            return nodes[a].a;
+        }
+        if ((op == OP_ABS || op == OP_SQUARE) && isOperation(a, OP_NEG)) {
+            return unary(op, nodes[a].a);
+        }
+        if (op == OP_ABS && isOperation(a, OP_ABS)) {
+            return a;
+        }
+        return intern(OPERATION, op, 0.0, a, -1);
+    }
+
+    int binary(int op, int a, int b) {
+        if (isConstant(a) && isConstant(b)) {
+            return constant(apply(op, nodes[a].value, nodes[b].value));
+        }
+
+        switch (op) {
+        case OP_ADD:
+            // x + 0 is +0 for x = -0, so only -0 can be dropped
+            if (isNegativeZero(a)) {
+                return b;
+            }
+            if (isNegativeZero(b)) {
+                return a;
+            }
+            if (isOperation(b, OP_NEG)) {
+                return binary(OP_SUB, a, nodes[b].a);
+            }
+            if (isOperation(a, OP_NEG)) {
+                return binary(OP_SUB, b, nodes[a].a);
+            }
+            break;
+        case OP_SUB:
+            // 0 - x is +0 for x = 0, not -x, so it is kept
+            if (isConstant(b, 0.0) && !std::signbit(nodes[b].value)) {
+                return a;
+            }
+            if (isOperation(b, OP_NEG)) {
+                return binary(OP_ADD, a, nodes[b].a);
+            }
+            break;
+        case OP_MUL:
+            if (isConstant(a)) {
+                std::swap(a, b);
+            }
+            if (isConstant(b, 1.0)) {
+                return a;
+            }
+            if (isConstant(b, -1.0)) {
+                return unary(OP_NEG, a);
+            }
+            if (a == b) {
+                return unary(OP_SQUARE, a);
+            }
+            if (isOperation(a, OP_NEG) && isOperation(b, OP_NEG)) {
+                return binary(OP_MUL, nodes[a].a, nodes[b].a);
+            }
+            break;
+        case OP_DIV:
+            if (isConstant(b, 1.0)) {
+                return a;
+            }
+            if (isConstant(b, -1.0)) {
+                return unary(OP_NEG, a);
+            }
+            if (isConstant(b) && hasExactReciprocal(nodes[b].value)) {
+                return binary(OP_MUL, a, constant(1.0 / nodes[b].value));
+            }
+            break;
+        case OP_POW:
+            if (isConstant(b, 0.0)) {
+                return constant(1.0);
+            }
+            if (isConstant(b, 1.0)) {
+                return a;
+            }
+            if (isConstant(b, 2.0)) {
+                return unary(OP_SQUARE, a);
+            }
+            if (isConstant(b, -1.0)) {
+                return binary(OP_DIV, constant(1.0), a);
+            }
+            break;
+        }
+
+        // One order for the operands of commutative operations, constants last
+        if (isCommutative(op) && (isConstant(a) || (!isConstant(b) && b < a))) {
+            std::swap(a, b);
+        }
+        return intern(OPERATION, op, 0.0, a, b);
+    }
+
+private:
+    std::map<std::tuple<int, int, uint64_t, int, int>, int> index;
+
+    int intern(Kind kind, int op, double value, int a, int b) {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        std::tuple<int, int, uint64_t, int, int> key(kind, op, bits, a, b);
+        std::map<std::tuple<int, int, uint64_t, int, int>, int>::const_iterator found = index.find(key);
+        if (found != index.end()) {
+            return found->second;
+        }
+
+        Node node = { kind, op, value, a, b };
+        nodes.push_back(node);
+        int id = static_cast<int>(nodes.size()) - 1;
+        index[key] = id;
+        return id;
+    }
+
+    bool isConstant(int id) const {
+        return nodes[id].kind == CONSTANT;
+    }
+
+    bool isConstant(int id, double value) const {
+        return nodes[id].kind == CONSTANT && nodes[id].value == value;
+    }
+
+    bool isNegativeZero(int id) const {
+        return isConstant(id, 0.0) && std::signbit(nodes[id].value);
+    }
+
+    bool isOperation(int id, int op) const {
+        return nodes[id].kind == OPERATION && nodes[id].op == op;
+    }
+
+    // Multiplying by 1 / value gives the same result as dividing by value
+    static bool hasExactReciprocal(double value) {
+        int exponent = 0;
+        return std::isfinite(value) && value != 0.0 && std::abs(std::frexp(value, &exponent)) == 0.5
+               && std::isnormal(1.0 / value);
+    }
+};
+
+/**
+ * @brief Recursive descent parser building the DAG
+ */
+class Parser {
+public:
+    Parser(const std::string& textVal, Builder& builderVal)
+        : text(textVal), pos(0), builder(builderVal) {}
+
+    int parse() {
+        int root = parseSum();
+        skipSpace();
+        if (pos < text.size()) {
+            fail(std::string("unexpected '") + text[pos] + "'");
+        }
+        return root;
+    }
+
+private:
+    const std::string& text;
+    size_t pos;
+    Builder& builder;
+
+    void fail(const std::string& message) const {
+        throw std::invalid_argument("Expression: " + message + " at position " + std::to_string(pos + 1)
+                                    + " in \"" + text + "\"");
+    }
+
+    void skipSpace() {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
+            ++pos;
+        }
+    }
+
+    bool accept(char c) {
+        skipSpace();
+        if (pos < text.size() && text[pos] == c) {
+            ++pos;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        if (!accept(c)) {
+            fail(std::string("expected '") + c + "'");
+        }
+    }
+
+    // sum := product (('+' | '-') product)*
+    int parseSum() {
+        int left = parseProduct();
+        for (;;) {
+            if (accept('+')) {
+                left = builder.binary(OP_ADD, left, parseProduct());
+            }
+            else if (accept('-')) {
+                left = builder.binary(OP_SUB, left, parseProduct());
+            }
+            else {
+                return left;
+            }
+        }
+    }
+
+    // product := unary (('*' | '/') unary)*
+    int parseProduct() {
+        int left = parseUnary();
+        for (;;) {
+            if (accept('*')) {
+                left = builder.binary(OP_MUL, left, parseUnary());
+            }
+            else if (accept('/')) {
+                left = builder.binary(OP_DIV, left, parseUnary());
+            }
+            else {
+                return left;
+            }
+        }
+    }
+
+    // unary := ('-' | '+') unary | power
+    int parseUnary() {
+        if (accept('-')) {
+            return builder.unary(OP_NEG, parseUnary());
+        }
+        if (accept('+')) {
+            return parseUnary();
+        }
+        return parsePower();
+    }
+
+    // power := primary ('^' unary)?, so -x^2 is -(x^2) and 2^3^2 is 2^(3^2)
+    int parsePower() {
+        int base = parsePrimary();
+        if (accept('^')) {
+            return builder.binary(OP_POW, base, parseUnary());
+        }
+        return base;
+    }
+
+    // primary := number | variable | constant | function '(' arguments ')' | '(' sum ')'
+    int parsePrimary() {
+        skipSpace();
+        if (pos >= text.size()) {
+            fail("expected a number, variable or '('");
+        }
+
+        char c = text[pos];
+        if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+            const char* start = text.c_str() + pos;
+            char* end = NULL;
+            double value = std::strtod(start, &end);
+            if (end == start) {
+                fail("malformed number");
+            }
+            pos += end - start;
+            return builder.constant(value);
+        }
+
+        if (std::isalpha(static_cast<unsigned char>(c))) {
+            size_t start = pos;
+            while (pos < text.size() && (std::isalnum(static_cast<unsigned char>(text[pos])) || text[pos] == '_')) {
+                ++pos;
+            }
+            std::string name = text.substr(start, pos - start);
+            if (name == "x") {
+                return builder.variable(Builder::VARIABLE_X);
+            }
+            if (name == "y") {
+                return builder.variable(Builder::VARIABLE_Y);
+            }
+            if (name == "pi") {
+                return builder.constant(PI);
+            }
+            if (name == "e") {
+                return builder.constant(E);
+            }
+            for (size_t i = 0; i < sizeof(FUNCTIONS) / sizeof(FUNCTIONS[0]); ++i) {
+                if (name == FUNCTIONS[i].name) {
+                    return parseCall(FUNCTIONS[i]);
+                }
+            }
+            pos = start;
+            fail("unknown name '" + name + "'");
+        }
+
+        if (accept('(')) {
+            int inner = parseSum();
+            expect(')');
+            return inner;
+        }
+        fail(std::string("unexpected '") + c + "'");
+        return -1;
+    }
+
+    int parseCall(const FunctionInfo& function) {
+        expect('(');
+        int first = parseSum();
+        if (function.arity == 1) {
+            expect(')');
+            return builder.unary(function.op, first);
+        }
+        expect(',');
+        int second = parseSum();
+        expect(')');
+        return builder.binary(function.op, first, second);
+    }
+};
+
+// Count the users of the nodes reachable from id and list them, operands before their users
+void collect(const Builder& builder, int id, std::vector<int>& uses, std::vector<int>& order) {
+    if (uses[id]++ > 0) {
+        return;
+    }
+    const Builder::Node& node = builder.nodes[id];
+    if (node.kind == Builder::OPERATION) {
+        collect(builder, node.a, uses, order);
+        if (!isUnary(node.op)) {
+            collect(builder, node.b, uses, order);
+        }
+    }
+    order.push_back(id);
+}
+
+} // namespace
+
+Expression::Expression(const std::string& textVal)
+    : text(textVal), registerCount(2), resultRegister(0), dependsOnY(false) {
+    Builder builder;
+    Parser parser(text, builder);
+    int root = parser.parse();
+
+    std::vector<int> uses(builder.nodes.size(), 0);
+    std::vector<int> order;
+    collect(builder, root, uses, order);
+
+    // x, y and the constants have fixed registers
+    std::vector<int> registers(builder.nodes.size(), -1);
+    for (size_t i = 0; i < order.size(); ++i) {
+        int id = order[i];
+        const Builder::Node& node = builder.nodes[id];
+        if (node.kind == Builder::VARIABLE_X) {
+            registers[id] = 0;
+        }
+        else if (node.kind == Builder::VARIABLE_Y) {
+            registers[id] = 1;
+            dependsOnY = true;
+        }
+        else if (node.kind == Builder::CONSTANT) {
+            registers[id] = static_cast<int>(2 + constants.size());
+            constants.push_back(node.value);
+        }
+    }
+
+    // Temporaries, reused once the last user of a value has read it
+    unsigned nextRegister = static_cast<unsigned>(2 + constants.size());
+    std::vector<unsigned> freeRegisters;
+    std::vector<int> remaining = uses;
+    auto release = [&](int id) {
+        if (builder.nodes[id].kind == Builder::OPERATION && --remaining[id] == 0) {
+            freeRegisters.push_back(static_cast<unsigned>(registers[id]));
+        }
+    };
+
+    for (size_t i = 0; i < order.size(); ++i) {
+        int id = order[i];
+        const Builder::Node& node = builder.nodes[id];
+        if (node.kind != Builder::OPERATION) {
+            continue;
+        }
+
+        bool unary = isUnary(node.op);
+        unsigned a = static_cast<unsigned>(registers[node.a]);
+        unsigned b = unary ? a : static_cast<unsigned>(registers[node.b]);
+        release(node.a);
+        if (!unary) {
+            release(node.b);
+        }
+
+        unsigned dst = 0;
+        if (!freeRegisters.empty()) {
+            dst = freeRegisters.back();
+            freeRegisters.pop_back();
+        }
+        else {
+            dst = nextRegister++;
+        }
+        if (dst >= MAX_REGISTERS) {
+            throw std::invalid_argument("Expression: too many registers needed for \"" + text + "\"");
+        }
+
+        Instruction instruction = { static_cast<uint8_t>(node.op), static_cast<uint8_t>(dst),
+                                    static_cast<uint8_t>(a), static_cast<uint8_t>(b) };
+        code.push_back(instruction);
+        registers[id] = static_cast<int>(dst);
+    }
+
+    if (nextRegister > MAX_REGISTERS) {
+        throw std::invalid_argument("Expression: too many constants in \"" + text + "\"");
+    }
+    registerCount = nextRegister;
+    resultRegister = static_cast<unsigned>(registers[root]);
+}
+
+double Expression::operator()(double x, double y) const {
+    double r[MAX_REGISTERS];
+    r[0] = x;
+    r[1] = y;
+    std::copy(constants.begin(), constants.end(), r + 2);
+
+    const Instruction* end = code.data() + code.size();
+    for (const Instruction* in = code.data(); in != end; ++in) {
+        double a = r[in->a];
+        double b = r[in->b];
+        double value;
+        switch (in->op) {
+        case OP_ADD: value = a + b; break;
+        case OP_SUB: value = a - b; break;
+        case OP_MUL: value = a * b; break;
+        case OP_DIV: value = a / b; break;
+        case OP_NEG: value = -a; break;
+        case OP_SQUARE: value = a * a; break;
+        default: value = apply(in->op, a, b); break;
+        }
+        r[in->dst] = value;
+    }
+    return r[resultRegister];
+}
+
+void Expression::operator()(size_t count, const double* x, const double* y, double* result) const {
+    // Register k of the block is r[k * width] .. r[k * width + width - 1]
+    const size_t width = std::min(MAX_BLOCK, BATCH_DOUBLES / registerCount);
+    double r[BATCH_DOUBLES];
+    for (size_t c = 0; c < constants.size(); ++c) {
+        std::fill(r + (2 + c) * width, r + (3 + c) * width, constants[c]);
+    }
+
+    for (size_t start = 0; start < count; start += width) {
+        const size_t m = std::min(width, count - start);
+        std::copy(x + start, x + start + m, r);
+        std::copy(y + start, y + start + m, r + width);
+
+        const Instruction* end = code.data() + code.size();
+        for (const Instruction* in = code.data(); in != end; ++in) {
+            double* d = r + in->dst * width;
+            const double* a = r + in->a * width;
+            const double* b = r + in->b * width;
+            switch (in->op) {
+            case OP_ADD: applyBlock(d, a, b, m, [](double u, double v) { return u + v; }); break;
+            case OP_SUB: applyBlock(d, a, b, m, [](double u, double v) { return u - v; }); break;
+            case OP_MUL: applyBlock(d, a, b, m, [](double u, double v) { return u * v; }); break;
+            case OP_DIV: applyBlock(d, a, b, m, [](double u, double v) { return u / v; }); break;
+            case OP_NEG: applyBlock(d, a, b, m, [](double u, double) { return -u; }); break;
+            case OP_SQUARE: applyBlock(d, a, b, m, [](double u, double) { return u * u; }); break;
+            case OP_SQRT: applyBlock(d, a, b, m, [](double u, double) { return std::sqrt(u); }); break;
+            case OP_EXP: applyBlock(d, a, b, m, [](double u, double) { return std::exp(u); }); break;
+            case OP_SIN: applyBlock(d, a, b, m, [](double u, double) { return std::sin(u); }); break;
+            case OP_COS: applyBlock(d, a, b, m, [](double u, double) { return std::cos(u); }); break;
+            default: {
+                int op = in->op;
+                applyBlock(d, a, b, m, [op](double u, double v) { return apply(op, u, v); });
+                break;
+            }
+            }
+        }
+
+        const double* value = r + resultRegister * width;
+        std::copy(value, value + m, result + start);
+    }
+}
+
+const std::string& Expression::getText() const {
+    return text;
+}
+
+bool Expression::usesY() const {
+    return dependsOnY;
+}
+
+size_t Expression::getInstructionCount() const {
+    return code.size();
+}
+
+std::string Expression::disassemble() const {
+    std::ostringstream out;
+    out.precision(17);
+    out << "r0 = x\nr1 = y\n";
+    for (size_t c = 0; c < constants.size(); ++c) {
+        out << "r" << 2 + c << " = " << constants[c] << "\n";
+    }
+    for (size_t i = 0; i < code.size(); ++i) {
+        const Instruction& in = code[i];
+        out << "r" << static_cast<int>(in.dst) << " = " << MNEMONICS[in.op] << " r" << static_cast<int>(in.a);
+        if (!isUnary(in.op)) {
+            out << ", r" << static_cast<int>(in.b);
+        }
+        out << "\n";
+    }
+    out << "return r" << resultRegister << "\n";
+    return out.str();
+}
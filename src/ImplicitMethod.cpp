@@ -0,0 +1,406 @@
+/**
+ * @file ImplicitMethod.cpp
+ * @brief Implementation of the Newton iteration shared by the implicit methods
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "ImplicitMethod.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+// Newton iteration settings, the increment norm relative to the tolerances
+const int MAX_NEWTON_ITERATIONS = 4;
+const double NEWTON_TOLERANCE = 0.1;
+const double DIVERGENCE_RATE = 0.9;     // Give up when an increment shrinks less than this
+const double SLOW_RATE = 0.3;           // Evaluate J again for the next step above this
+
+} // namespace
+
+ImplicitMethod::ImplicitMethod(std::function<double(double, double)> diffFunc)
+    : NumericalMethod(diffFunc), adaptive(false), size(1),
+      evaluations(0), jacobianEvaluations(0), factorizations(0), newtonIterations(0),
+      acceptedSteps(0), rejectedSteps(0), systemSolve(false), buffers(NULL), jac(NULL), lu(NULL),
+      fValues(NULL), residual(NULL), guess(NULL), perturbed(NULL), factorGammaH(0.0),
+      jacobianCurrent(false) {
+}
+
+void ImplicitMethod::setJacobian(std::function<double(double, double)> dfdy) {
+    jacobian = dfdy;
+}
+
+void ImplicitMethod::setSystemJacobian(SystemJacobian dfdy) {
+    systemJacobian = dfdy;
+}
+
+void ImplicitMethod::setTolerances(double absTol, double relTol) {
+    tolerances.set(absTol, relTol);
+}
+
+void ImplicitMethod::solve() {
+    systemSolve = false;
+    size = 1;
+
+    std::ostream& out = traceStream();
+
+    beginSolve();
+
+    if (verbose) {
+        out << "\n=== " << getMethodName() << " ===" << std::endl;
+        out << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0
+            << ", y0 = " << y0 << std::endl;
+        out << (adaptive ? "Initial step size: h = " : "Step size: h = ") << stepSize << std::endl;
+        tolerances.print(out);
+        out << "Target x: " << std::fixed << std::setprecision(4) << xTarget << std::endl;
+        beginTrace(stepFormatter());
+    }
+
+    runSolve(&y0);
+
+    // Every evaluation is already counted
+    instrumentation.countCalls(evaluations);
+    endSolve();
+    endTrace();
+
+    if (verbose) {
+        out << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget
+            << ": y = " << getResult() << std::endl;
+        out << "Accepted steps: " << acceptedSteps << ", rejected steps: " << rejectedSteps
+            << ", function evaluations: " << evaluations << std::endl;
+        out << "Jacobian evaluations: " << jacobianEvaluations << ", LU factorizations: "
+            << factorizations << ", Newton iterations: " << newtonIterations << std::endl;
+
+        if (compareExact) {
+            double exact = exactFunction(xTarget);
+            double error = std::abs(exact - getResult());
+            out << "Exact solution: " << exact << std::endl;
+            out << "Error: " << std::scientific << std::setprecision(2) << error << std::endl;
+            out << std::fixed << std::setprecision(4);
+        }
+    }
+}
+
+void ImplicitMethod::solveSystem() {
+    checkSystemReady();
+    systemSolve = true;
+    size = dimension;
+
+    beginSolve();
+    runSolve(initialState.data());
+    instrumentation.countCalls(evaluations);
+    printSystemSummary();
+    endSolve();
+}
+
+void ImplicitMethod::runSolve(const double* initial) {
+    evaluations = 0;
+    jacobianEvaluations = 0;
+    factorizations = 0;
+    newtonIterations = 0;
+    acceptedSteps = 0;
+    rejectedSteps = 0;
+
+    // Buffers of the Newton iteration, from the reused workspace
+    buffers = &solveWorkspace();
+    jac = scratch(size * size);
+    lu = scratch(size * size);
+    fValues = scratch(size);
+    residual = scratch(size);
+    guess = scratch(size);
+    perturbed = scratch(size);
+    pivots.resize(size);
+    factorGammaH = 0.0;
+    jacobianCurrent = false;
+
+    double* y = scratch(size);
+    std::copy(initial, initial + size, y);
+    integrate(y);
+
+    steps = acceptedSteps;
+}
+
+double* ImplicitMethod::scratch(size_t count) {
+    return buffers->allocate(count);
+}
+
+void ImplicitMethod::evaluate(double x, const double* y, double* dydx) {
+    ++evaluations;
+    evaluateRhs(systemSolve, x, y, dydx);
+}
+
+void ImplicitMethod::evaluateJacobian(double x, const double* y, const double* f) {
+    ++jacobianEvaluations;
+    jacobianCurrent = true;
+    factorGammaH = 0.0;
+
+    if (!systemSolve && jacobian) {
+        jac[0] = jacobian(x, y[0]);
+        return;
+    }
+    if (systemSolve && systemJacobian) {
+        systemJacobian(x, y, jac);
+        return;
+    }
+
+    // Forward differences, one column per component
+    const size_t n = size;
+    const double root = std::sqrt(DBL_EPSILON);
+    std::copy(y, y + n, perturbed);
+    for (size_t c = 0; c < n; ++c) {
+        double delta = root * std::max(std::abs(y[c]), 1.0);
+        perturbed[c] = y[c] + delta;
+        evaluate(x, perturbed, residual);
+        perturbed[c] = y[c];
+
+        for (size_t i = 0; i < n; ++i) {
+            jac[i * n + c] = (residual[i] - f[i]) / delta;
+        }
+    }
+}
+
+double ImplicitMethod::jacobianNorm(double x, const double* y) {
+    // Finite differences need f(x, y)
+    bool analytic = systemSolve ? static_cast<bool>(systemJacobian) : static_cast<bool>(jacobian);
+    if (!analytic) {
+        evaluate(x, y, fValues);
+    }
+    evaluateJacobian(x, y, fValues);
+
+    const size_t n = size;
+    double norm = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double sum = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            sum += std::abs(jac[i * n + j]);
+        }
+        norm = std::max(norm, sum);
+    }
+    return norm;
+}
+
+bool ImplicitMethod::factorize(double gammaH) {
+    const size_t n = size;
+    ++factorizations;
+    factorGammaH = 0.0;
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            lu[i * n + j] = (i == j ? 1.0 : 0.0) - gammaH * jac[i * n + j];
+        }
+    }
+
+    // LU decomposition with partial pivoting
+    for (size_t k = 0; k < n; ++k) {
+        size_t pivot = k;
+        for (size_t i = k + 1; i < n; ++i) {
+            if (std::abs(lu[i * n + k]) > std::abs(lu[pivot * n + k])) {
+                pivot = i;
+            }
+        }
+        pivots[k] = pivot;
+        if (lu[pivot * n + k] == 0.0) {
+            return false;
+        }
+        if (pivot != k) {
+            std::swap_ranges(lu + k * n, lu + (k + 1) * n, lu + pivot * n);
+        }
+
+        for (size_t i = k + 1; i < n; ++i) {
+            double m = lu[i * n + k] / lu[k * n + k];
+            lu[i * n + k] = m;
+            for (size_t j = k + 1; j < n; ++j) {
+                lu[i * n + j] -= m * lu[k * n + j];
+            }
+        }
+    }
+
+    factorGammaH = gammaH;
+    return true;
+}
+
+void ImplicitMethod::luSolve(double* b) const {
+    const size_t n = size;
+    for (size_t k = 0; k < n; ++k) {
+        std::swap(b[k], b[pivots[k]]);
+    }
+    for (size_t i = 1; i < n; ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            b[i] -= lu[i * n + j] * b[j];
+        }
+    }
+    for (size_t i = n; i-- > 0;) {
+        for (size_t j = i + 1; j < n; ++j) {
+            b[i] -= lu[i * n + j] * b[j];
+        }
+        b[i] /= lu[i * n + i];
+    }
+}
+
+bool ImplicitMethod::newtonSolve(double x, const double* psi, double gammaH, double* y) {
+    const size_t n = size;
+    bool fresh = false;     // J evaluated in this call
+    std::copy(y, y + n, guess);
+
+    for (;;) {
+        std::copy(guess, guess + n, y);
+        if (!jacobianCurrent) {
+            evaluate(x, y, fValues);
+            evaluateJacobian(x, y, fValues);
+            fresh = true;
+        }
+
+        bool converged = false;
+        double rate = 0.0;
+        if (gammaH == factorGammaH || factorize(gammaH)) {
+            double previous = 0.0;
+            for (int it = 0; it < MAX_NEWTON_ITERATIONS; ++it) {
+                ++newtonIterations;
+                evaluate(x, y, fValues);
+                for (size_t i = 0; i < n; ++i) {
+                    residual[i] = psi[i] + gammaH * fValues[i] - y[i];
+                }
+                luSolve(residual);
+                for (size_t i = 0; i < n; ++i) {
+                    y[i] += residual[i];
+                }
+
+                double norm = tolerances.scaledNorm(size, residual, y, y);
+                if (!std::isfinite(norm)) {
+                    break;
+                }
+                if (it > 0) {
+                    rate = norm / previous;
+                }
+                if (norm <= NEWTON_TOLERANCE) {
+                    converged = true;
+                    break;
+                }
+                if (it > 0 && rate > DIVERGENCE_RATE) {
+                    break;
+                }
+                previous = norm;
+            }
+        }
+
+        if (converged) {
+            // Slow convergence: a new J for the next step
+            if (rate > SLOW_RATE) {
+                jacobianCurrent = false;
+            }
+            return true;
+        }
+        if (fresh) {
+            std::copy(guess, guess + n, y);
+            return false;
+        }
+
+        // Try again with a new J
+        jacobianCurrent = false;
+    }
+}
+
+void ImplicitMethod::integrateTheta(double* y, double theta) {
+    const size_t n = size;
+    double* f = scratch(n);
+    double* psi = scratch(n);
+    double* yNew = scratch(n);
+    double x = x0;
+
+    if (theta < 1.0) {
+        evaluate(x, y, f);
+    }
+    else {
+        std::fill(f, f + n, 0.0);
+    }
+
+    for (int i = 1; i <= steps; ++i) {
+        PhaseSample sample(instrumentation);
+
+        // Known part of the formula
+        for (size_t j = 0; j < n; ++j) {
+            psi[j] = y[j] + (1.0 - theta) * stepSize * f[j];
+        }
+
+        // The previous point is a safe guess for stiff problems
+        std::copy(y, y + n, yNew);
+        if (!newtonSolve(x + stepSize, psi, theta * stepSize, yNew)) {
+            throw std::runtime_error(cachedMethodName() + ": Newton iteration did not converge; "
+                                     "use a smaller step size");
+        }
+
+        double xStart = x;
+        x += stepSize;
+        std::copy(yNew, yNew + n, y);
+        if (theta < 1.0) {
+            evaluate(x, y, f);
+        }
+
+        sample.enter(SolvePhase::Storage);
+        acceptStep(xStart, x, y, stepSize, 0.0);
+        sample.enter(SolvePhase::None);
+    }
+}
+
+void ImplicitMethod::acceptStep(double xStart, double x, const double* y, double h, double errorEstimate) {
+    ++acceptedSteps;
+    if (systemSolve) {
+        storeState(x, y);
+        return;
+    }
+
+    recordStep(x, y[0]);
+    if (verbose) {
+        StepRecord record;
+        record.step = acceptedSteps;
+        record.xStart = xStart;
+        record.x = x;
+        record.y = y[0];
+        record.h = h;
+        record.errorEstimate = errorEstimate;
+        traceStep(record);
+    }
+}
+
+void ImplicitMethod::traceRejected(double x, const double* y, double hNew) {
+    if (systemSolve || !verbose) {
+        return;
+    }
+
+    StepRecord record;
+    record.kind = StepRecord::Rejected;
+    record.xStart = x;
+    record.x = x;
+    record.y = y[0];
+    record.h = hNew;
+    traceStep(record);
+}
+
+long ImplicitMethod::getFunctionEvaluations() const {
+    return evaluations;
+}
+
+long ImplicitMethod::getJacobianEvaluations() const {
+    return jacobianEvaluations;
+}
+
+long ImplicitMethod::getFactorizations() const {
+    return factorizations;
+}
+
+long ImplicitMethod::getNewtonIterations() const {
+    return newtonIterations;
+}
+
+int ImplicitMethod::getAcceptedSteps() const {
+    return acceptedSteps;
+}
+
+int ImplicitMethod::getRejectedSteps() const {
+    return rejectedSteps;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file Instrumentation.cpp
+ * @brief Implementation of the solver instrumentation and trace export
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "Instrumentation.h"
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <algorithm>
+
+namespace {
+
+// Small sequential ids read better in trace viewers than hashed thread ids
+unsigned currentThreadId() {
+    static std::atomic<unsigned> nextId(1);
+    thread_local unsigned id = nextId++;
+    return id;
+}
+
+#ifdef ODE_ENABLE_INSTRUMENTATION
+// Smallest difference between two consecutive tick reads
+uint64_t measureTickOverhead() {
+    uint64_t best = ~static_cast<uint64_t>(0);
+    for (int i = 0; i < 32; ++i) {
+        uint64_t first = readTicks();
+        uint64_t second = readTicks();
+        best = std::min(best, second - first);
+    }
+    return best;
+}
+#endif
+
+} // namespace
+
+TraceRecorder::TraceRecorder() : recording(false), epoch(std::chrono::steady_clock::now()) {
+}
+
+TraceRecorder& TraceRecorder::instance() {
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+void TraceRecorder::start() {
+    recording.store(true);
+}
+
+void TraceRecorder::stop() {
+    recording.store(false);
+}
+
+void TraceRecorder::addSpan(const std::string& name, const std::string& category,
+                            std::chrono::steady_clock::time_point start, double seconds,
+                            const std::string& args) {
+    Span span;
+    span.name = name;
+    span.category = category;
+    span.args = args;
+    span.startMicros = std::chrono::duration<double, std::micro>(start - epoch).count();
+    span.durationMicros = seconds * 1e6;
+    span.thread = currentThreadId();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    spans.push_back(span);
+}
+
+void TraceRecorder::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    spans.clear();
+}
+
+void TraceRecorder::save(const std::string& filename) const {
+    std::FILE* file = std::fopen(filename.c_str(), "w");
+    if (file == NULL) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::fprintf(file, "{\"traceEvents\": [\n");
+    for (size_t i = 0; i < spans.size(); ++i) {
+        const Span& span = spans[i];
+        std::fprintf(file, "  {\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"ts\": %.3f, "
+                     "\"dur\": %.3f, \"pid\": 1, \"tid\": %u, \"args\": %s}%s\n",
+                     span.name.c_str(), span.category.c_str(), span.startMicros,
+                     span.durationMicros, span.thread, span.args.empty() ? "{}" : span.args.c_str(),
+                     (i + 1 < spans.size()) ? "," : "");
+    }
+    std::fprintf(file, "], \"displayTimeUnit\": \"ms\"}\n");
+
+    if (std::fclose(file) != 0) {
+        throw std::runtime_error("Failed to write file: " + filename);
+    }
+}
+
+void SolveInstrumentation::beginSolve() {
+#ifdef ODE_ENABLE_INSTRUMENTATION
+    pendingCalls = 0;
+    rhsCalls.store(0, std::memory_order_relaxed);
+    stepCount = 0;
+    sampledSteps = 0;
+    phaseTicks[0] = phaseTicks[1] = phaseTicks[2] = 0;
+    static const uint64_t overhead = measureTickOverhead();
+    tickOverhead = overhead;
+    startTime = std::chrono::steady_clock::now();
+    startTicks = readTicks();
+#endif
+}
+
+void SolveInstrumentation::endSolve(const std::string& methodName) {
+#ifdef ODE_ENABLE_INSTRUMENTATION
+    uint64_t endTicks = readTicks();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    rhsCalls.store(pendingCalls, std::memory_order_relaxed);
+
+    // Calibrate ticks against the clock over the whole solve, then scale
+    // the sampled steps up to all steps
+    double secondsPerTick = (endTicks > startTicks) ? seconds / (endTicks - startTicks) : 0.0;
+    double scale = (sampledSteps > 0) ? static_cast<double>(stepCount) / sampledSteps : 0.0;
+
+    stats.rhsCalls = pendingCalls;
+    stats.steps = stepCount;
+    stats.solveSeconds = seconds;
+    stats.roundingSeconds = phaseTicks[static_cast<int>(SolvePhase::Rounding)] * secondsPerTick * scale;
+    stats.storageSeconds = phaseTicks[static_cast<int>(SolvePhase::Storage)] * secondsPerTick * scale;
+    stats.steppingSeconds = seconds - stats.roundingSeconds - stats.storageSeconds;
+    if (stats.steppingSeconds < 0.0) {
+        stats.steppingSeconds = 0.0;
+    }
+
+    if (TraceRecorder::instance().isRecording()) {
+        std::ostringstream args;
+        args << "{\"rhsCalls\": " << stats.rhsCalls
+             << ", \"steps\": " << stats.steps
+             << ", \"steppingSeconds\": " << stats.steppingSeconds
+             << ", \"roundingSeconds\": " << stats.roundingSeconds
+             << ", \"storageSeconds\": " << stats.storageSeconds << "}";
+        TraceRecorder::instance().addSpan(methodName, "solve", startTime, seconds, args.str());
+    }
+#else
+    (void)methodName;
+#endif
+}
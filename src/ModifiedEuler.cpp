@@ -6,10 +6,12 @@
  */
 
 #include "ModifiedEuler.h"
+#include "StaticSolver.h"
+#include "PrecisionPolicy.h"
 #include <iostream>
 #include <iomanip>
-#include <chrono>
-#include <thread>
+#include <cmath>
+#include <algorithm>
 
 ModifiedEulersMethod::ModifiedEulersMethod(std::function<double(double, double)> diffFunc) 
     : NumericalMethod(diffFunc) {}
@@ -19,72 +21,112 @@ void ModifiedEulersMethod::solve() {
     double x = x0;
     double y = y0;
     
+    std::ostream& out = traceStream();
+    
+    beginSolve();
+    
     if (verbose) {
-        std::cout << "\n=== Modified Euler's Method (Heun's Method) ===" << std::endl;
-        std::cout << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0 
-                  << ", y0 = " << y0 << std::endl;
-        std::cout << "Step size: h = " << stepSize << std::endl;
-        std::cout << "Target x: " << xTarget << std::endl;
+        out << "\n=== Modified Euler's Method (Heun's Method) ===" << std::endl;
+        out << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0 
+            << ", y0 = " << y0 << std::endl;
+        out << "Step size: h = " << stepSize << std::endl;
+        out << "Target x: " << xTarget << std::endl;
+        beginTrace(formatModifiedEulerStep);
     }
     
+    double k[ModifiedEulerStepper::stages];
+    
+    // Counts the calls the stepper makes
+    auto rhs = countCalls(diffFunction, instrumentation);
+    
     // Solve step by step
     for (int i = 0; i < steps; ++i) {
-        // Step 1: Calculate predictor (Euler's method)
-        double k1 = diffFunction(x, y);
-        double xNext = x + stepSize;
-        double yPredictor = y + stepSize * k1;
+        PhaseSample sample(instrumentation);
         
-        // Step 2: Calculate corrector
-        double k2 = diffFunction(xNext, yPredictor);
-        double yCorrector = y + stepSize * 0.5 * (k1 + k2);
+        // Predictor (Euler's method) and corrector slopes in k[0] and k[1]
+        double increment = ModifiedEulerStepper::step(rhs, x, y, stepSize, k);
+        double xNext = x + stepSize;
+        double yCorrector = y + increment;
         
-        // Round to 4 decimal places
-        yPredictor = std::round(yPredictor * 10000.0) / 10000.0;
-        yCorrector = std::round(yCorrector * 10000.0) / 10000.0;
+        sample.enter(SolvePhase::Rounding);
+        // Round to 4 decimal places in classroom precision
+        yCorrector = PrecisionPolicy::apply(yCorrector);
         
         // Update values
+        double xStart = x, yStart = y;
         x = xNext;
         y = yCorrector;
         
         // Store values
-        xValues.push_back(x);
-        yValues.push_back(y);
+        sample.enter(SolvePhase::Storage);
+        recordStep(x, y);
+        sample.enter(SolvePhase::None);
         
         if (verbose) {
-            std::cout << "\nStep " << (i + 1) << ":" << std::endl;
-            std::cout << "x = " << std::fixed << std::setprecision(4) << x << std::endl;
-            std::cout << "Predictor (Euler): y* = " << yPredictor << std::endl;
-            std::cout << "Corrector (Modified): y = " << y << std::endl;
-            
-            if (compareExact) {
-                double exact = exactSolution(x);
-                // Round to 4 decimal places
-                exact = std::round(exact * 10000.0) / 10000.0;
-                double error = std::abs(exact - y);
-                std::cout << "Exact solution: " << exact << std::endl;
-                std::cout << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
-            }
-            
-            // Add small delay for better user experience
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            StepRecord record;
+            record.step = i + 1;
+            record.xStart = xStart;
+            record.yStart = yStart;
+            record.x = x;
+            record.y = y;
+            record.k[0] = k[0];
+            record.k[1] = k[1];
+            record.h = stepSize;
+            traceStep(record);
         }
     }
     
+    endSolve();
+    endTrace();
+    
     if (verbose) {
-        std::cout << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget 
-                  << ": y = " << y << std::endl;
+        out << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget 
+            << ": y = " << y << std::endl;
         
         if (compareExact) {
-            double exact = exactSolution(xTarget);
+            double exact = exactFunction(xTarget);
             // Round to 4 decimal places
             exact = std::round(exact * 10000.0) / 10000.0;
             double error = std::abs(exact - y);
-            std::cout << "Exact solution: " << exact << std::endl;
-            std::cout << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
+            out << "Exact solution: " << exact << std::endl;
+            out << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
         }
     }
 }
 
+void ModifiedEulersMethod::solveSystem() {
+    checkSystemReady();
+    const size_t n = dimension;
+    
+    // State, stage slopes and predictor, from the reused workspace
+    double* y = solveWorkspace().allocate(4 * n);
+    double* k1 = y + n;
+    double* k2 = k1 + n;
+    double* yPredictor = k2 + n;
+    
+    std::copy(initialState.begin(), initialState.end(), y);
+    double x = x0;
+    
+    auto rhs = countCalls(systemFunction, instrumentation);
+    beginSolve();
+    for (int i = 0; i < steps; ++i) {
+        // Predictor (Euler) followed by the trapezoidal corrector
+        rhs(x, y, k1);
+        addScaled(n, y, stepSize, k1, yPredictor);
+        rhs(x + stepSize, yPredictor, k2);
+        
+        for (size_t j = 0; j < n; ++j) {
+            y[j] += stepSize * 0.5 * (k1[j] + k2[j]);
+        }
+        x += stepSize;
+        
+        storeState(x, y);
+    }
+    
+    printSystemSummary();
+    endSolve();
+}
+
 std::string ModifiedEulersMethod::getMethodName() const {
     return "Modified Euler's Method";
 }
\ No newline at end of file
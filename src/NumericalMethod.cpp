@@ -6,11 +6,14 @@
  */
 
 #include "NumericalMethod.h"
+#include "TrajectoryFile.h"
+#include "CsvWriter.h"
 #include <iostream>
 #include <iomanip>
-#include <fstream>
 #include <cmath>
 #include <stdexcept>
+#include <algorithm>
+#include <functional>
 
 // Implementation of default differential equation function
 double differentialFunction(double x, double y) {
@@ -30,19 +33,30 @@ double exactSolution(double x) {
 }
 
 NumericalMethod::NumericalMethod(std::function<double(double, double)> diffFunc) 
-    : diffFunction(diffFunc), verbose(true), compareExact(false) {}
+    : verbose(true), compareExact(false), diffFunction(diffFunc), exactFunction(exactSolution), dimension(0),
+      hasResult(false), lastX(0.0), lastY(0.0), denseOutput(false), denseStride(0),
+      workspace(&ownWorkspace), traceOutput(&std::cout), traceDelay(-1) {}
 
 NumericalMethod::~NumericalMethod() {}
 
 void NumericalMethod::setParameters(double x0Val, double y0Val, double xTargetVal, double stepSizeVal) {
+    ScopedPhaseTimer timer(instrumentation, &SolveInstrumentation::setSetupSeconds, "setParameters");
+    
+    reset();
     x0 = x0Val;
     y0 = y0Val;
     xTarget = xTargetVal;
     stepSize = stepSizeVal;
+    dimension = 0;
     
     // Calculate number of steps
     steps = static_cast<int>((xTarget - x0) / stepSize + 0.5);
     
+    // Streamed solves get the initial point at the start of solve()
+    if (observer) {
+        return;
+    }
+    
     // Pre-allocate memory for results
     xValues.reserve(steps + 1);
     yValues.reserve(steps + 1);
@@ -52,15 +66,191 @@ void NumericalMethod::setParameters(double x0Val, double y0Val, double xTargetVa
     yValues.push_back(y0);
 }
 
+void NumericalMethod::setParameters(double x0Val, const std::vector<double>& y0Val, double xTargetVal, double stepSizeVal) {
+    ScopedPhaseTimer timer(instrumentation, &SolveInstrumentation::setSetupSeconds, "setParameters");
+    
+    if (y0Val.empty()) {
+        throw std::invalid_argument("Initial state must have at least one component");
+    }
+    
+    reset();
+    x0 = x0Val;
+    y0 = y0Val[0];
+    xTarget = xTargetVal;
+    stepSize = stepSizeVal;
+    dimension = y0Val.size();
+    initialState = y0Val;
+    lastState.resize(dimension);
+    
+    // Calculate number of steps
+    steps = static_cast<int>((xTarget - x0) / stepSize + 0.5);
+    
+    if (observer) {
+        return;
+    }
+    
+    // Pre-allocate memory for results
+    xValues.reserve(steps + 1);
+    stateValues.reserve((steps + 1) * dimension);
+    
+    // Store initial state
+    storeState(x0, y0Val.data());
+}
+
+void NumericalMethod::reset() {
+    xValues.clear();
+    yValues.clear();
+    stateValues.clear();
+    denseValues.clear();
+    hasResult = false;
+}
+
+void NumericalMethod::setWorkspace(Workspace* ws) {
+    workspace = (ws != NULL) ? ws : &ownWorkspace;
+}
+
+const std::string& NumericalMethod::cachedMethodName() const {
+    if (cachedName.empty()) {
+        cachedName = getMethodName();
+    }
+    return cachedName;
+}
+
+void NumericalMethod::setSystemFunction(SystemFunction sysFunc) {
+    systemFunction = sysFunc;
+}
+
+void NumericalMethod::setObserver(std::shared_ptr<StepObserver> obs) {
+    observer = obs;
+}
+
+void NumericalMethod::beginSolve() {
+    if (observer) {
+        observer->begin(cachedMethodName(), dimension > 0 ? -1 : steps);
+        if (dimension > 0) {
+            storeState(x0, initialState.data());
+        }
+        else {
+            recordStep(x0, y0);
+        }
+    }
+    
+    // Started after the initial point, so only steps are counted
+    instrumentation.beginSolve();
+}
+
+void NumericalMethod::endSolve() {
+    instrumentation.endSolve(cachedMethodName());
+    
+    if (observer) {
+        observer->end();
+    }
+}
+
+void NumericalMethod::beginTrace(StepFormatter formatter) {
+    if (!tracePipeline) {
+        tracePipeline.reset(new TracePipeline());
+    }
+    
+    // Pause on the console only, where someone may be reading along
+    int delay = traceDelay;
+    if (delay < 0) {
+        delay = traceFile ? 0 : 100;
+    }
+    tracePipeline->start(*traceOutput, formatter, compareExact, delay);
+}
+
+void NumericalMethod::endTrace() {
+    if (tracePipeline) {
+        tracePipeline->finish();
+    }
+}
+
+void NumericalMethod::storeState(double x, const double* y) {
+    instrumentation.countStep();
+    lastX = x;
+    hasResult = true;
+    if (observer) {
+        std::copy(y, y + dimension, lastState.begin());
+        observer->observe(x, y, dimension);
+    }
+    else {
+        xValues.push_back(x);
+        stateValues.insert(stateValues.end(), y, y + dimension);
+    }
+}
+
+void NumericalMethod::checkSystemReady() const {
+    if (dimension == 0) {
+        throw std::runtime_error("System parameters have not been set");
+    }
+    if (!systemFunction) {
+        throw std::runtime_error("System function has not been set");
+    }
+}
+
+void NumericalMethod::printSystemSummary() const {
+    if (!verbose) {
+        return;
+    }
+    
+    std::cout << "\n=== " << getMethodName() << " (system of " << dimension << " equations) ===" << std::endl;
+    std::cout << "Step size: h = " << std::fixed << std::setprecision(4) << stepSize << std::endl;
+    std::cout << "Final result at x = " << lastX << ":" << std::endl;
+    
+    std::vector<double> y = getStateResult();
+    for (size_t j = 0; j < dimension; ++j) {
+        std::cout << "y[" << j << "] = " << y[j] << std::endl;
+    }
+}
+
+void NumericalMethod::solveSystem() {
+    throw std::runtime_error(getMethodName() + " does not support systems of equations");
+}
+
 void NumericalMethod::setVerbose(bool isVerbose) {
     verbose = isVerbose;
 }
 
+void NumericalMethod::setTraceFile(const std::string& filename) {
+    endTrace();
+    if (filename.empty()) {
+        traceFile.reset();
+        traceOutput = &std::cout;
+        return;
+    }
+    
+    std::unique_ptr<std::ofstream> file(new std::ofstream(filename.c_str()));
+    if (!*file) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+    traceFile = std::move(file);
+    traceOutput = traceFile.get();
+}
+
+void NumericalMethod::setTraceDelay(int millis) {
+    traceDelay = millis;
+}
+
 void NumericalMethod::setCompareExact(bool doCompare) {
     compareExact = doCompare;
 }
 
+void NumericalMethod::setExactSolution(std::function<double(double)> exact) {
+    exactFunction = exact ? exact : std::function<double(double)>(exactSolution);
+}
+
+double NumericalMethod::exactAt(double x) const {
+    return exactFunction(x);
+}
+
 double NumericalMethod::getResult() const {
+    if (observer) {
+        if (!hasResult) {
+            throw std::runtime_error("Method has not been solved yet");
+        }
+        return lastY;
+    }
     if (yValues.empty()) {
         throw std::runtime_error("Method has not been solved yet");
     }
@@ -75,36 +265,158 @@ const std::vector<double>& NumericalMethod::getYValues() const {
     return yValues;
 }
 
-void NumericalMethod::saveToCSV(const std::string& filename) const {
-    std::ofstream file(filename);
-    
-    if (!file.is_open()) {
-        throw std::runtime_error("Failed to open file: " + filename);
+size_t NumericalMethod::getDimension() const {
+    return dimension;
+}
+
+const std::vector<double>& NumericalMethod::getStateValues() const {
+    return stateValues;
+}
+
+const double* NumericalMethod::getState(size_t step) const {
+    if (dimension == 0 || (step + 1) * dimension > stateValues.size()) {
+        throw std::out_of_range("No system state stored for this step");
+    }
+    return &stateValues[step * dimension];
+}
+
+std::vector<double> NumericalMethod::getStateResult() const {
+    if (observer && dimension > 0 && hasResult) {
+        return lastState;
     }
+    if (dimension == 0 || stateValues.empty()) {
+        throw std::runtime_error("System has not been solved yet");
+    }
+    return std::vector<double>(stateValues.end() - dimension, stateValues.end());
+}
+
+const SolveStats& NumericalMethod::getSolveStats() const {
+    return instrumentation.getStats();
+}
+
+long NumericalMethod::getRhsCallCount() const {
+    return instrumentation.getRhsCalls();
+}
+
+void NumericalMethod::setDenseOutput(bool enable) {
+    denseOutput = enable;
+}
+
+double NumericalMethod::interpolateStep(size_t i, double theta) const {
+    double h = xValues[i + 1] - xValues[i];
+    double yLeft = yValues[i];
+    double yRight = yValues[i + 1];
+    double fLeft = diffFunction(xValues[i], yLeft);
+    double fRight = diffFunction(xValues[i + 1], yRight);
+    
+    // Cubic Hermite basis functions
+    double theta2 = theta * theta;
+    double theta3 = theta2 * theta;
+    double h00 = 2.0 * theta3 - 3.0 * theta2 + 1.0;
+    double h10 = theta3 - 2.0 * theta2 + theta;
+    double h01 = -2.0 * theta3 + 3.0 * theta2;
+    double h11 = theta3 - theta2;
     
-    // Write header
-    file << "Step,x,y";
-    if (compareExact) {
-        file << ",exact,error";
+    return h00 * yLeft + h10 * h * fLeft + h01 * yRight + h11 * h * fRight;
+}
+
+double NumericalMethod::evaluateAt(double x) const {
+    double y;
+    evaluateAt(&x, 1, &y);
+    return y;
+}
+
+void NumericalMethod::evaluateAt(const double* xs, size_t count, double* out) const {
+    if (xValues.size() < 2 || yValues.size() != xValues.size()) {
+        throw std::runtime_error("Method has not been solved yet");
     }
-    file << std::endl;
     
-    // Write data with 4 decimal precision
-    file << std::fixed << std::setprecision(4);
+    const size_t last = xValues.size() - 1;
+    size_t i = 0;
     
-    for (size_t i = 0; i < xValues.size(); ++i) {
-        file << i << "," << xValues[i] << "," << yValues[i];
+    // Backward solves store x in descending order; sign makes sign * x ascending
+    const bool ascending = xValues.back() >= xValues.front();
+    const double sign = ascending ? 1.0 : -1.0;
+    const double lower = std::min(xValues.front(), xValues.back());
+    const double upper = std::max(xValues.front(), xValues.back());
+    
+    // Accept queries within rounding distance of the ends, since x is
+    // accumulated step by step and may stop just short of xTarget
+    const double slack = 1e-9 * (upper - lower);
+    
+    for (size_t q = 0; q < count; ++q) {
+        double x = xs[q];
+        if (!(x >= lower - slack && x <= upper + slack)) {
+            throw std::out_of_range("Query point outside the solved interval");
+        }
+        x = std::min(std::max(x, lower), upper);
+        double u = sign * x;
         
-        if (compareExact) {
-            double exact = exactSolution(xValues[i]);
-            double error = std::abs(exact - yValues[i]);
-            file << "," << exact << "," << error;
+        // Scan forward for queries in the direction of integration, otherwise use binary search
+        if (u >= sign * xValues[i] && (i + 1 > last || u <= sign * xValues[i + 1])) {
+            // Same step as the previous query
+        }
+        else if (u > sign * xValues[i] && i + 2 <= last && u <= sign * xValues[i + 2]) {
+            ++i;
+        }
+        else {
+            i = (ascending ? std::upper_bound(xValues.begin(), xValues.end(), x)
+                           : std::upper_bound(xValues.begin(), xValues.end(), x, std::greater<double>()))
+                - xValues.begin();
+            i = (i == 0) ? 0 : i - 1;
+        }
+        if (i >= last) {
+            i = last - 1;
         }
         
-        file << std::endl;
+        double h = xValues[i + 1] - xValues[i];
+        double theta = (h != 0.0) ? (x - xValues[i]) / h : 0.0;
+        out[q] = interpolateStep(i, theta);
+    }
+}
+
+std::vector<double> NumericalMethod::evaluateAt(const std::vector<double>& xs) const {
+    std::vector<double> ys(xs.size());
+    if (!xs.empty()) {
+        evaluateAt(xs.data(), xs.size(), ys.data());
+    }
+    return ys;
+}
+
+void NumericalMethod::saveToCSV(const std::string& filename) const {
+    ScopedPhaseTimer timer(instrumentation, &SolveInstrumentation::setExportSeconds, "saveToCSV");
+    std::function<double(double)> exact;
+    if (compareExact && dimension == 0) {
+        exact = exactFunction;
+    }
+    
+    if (dimension > 0) {
+        CsvWriter::write(filename, xValues.data(), stateValues.data(), xValues.size(), dimension, exact);
+    }
+    else {
+        CsvWriter::write(filename, xValues.data(), yValues.data(), xValues.size(), 1, exact);
+    }
+    
+    if (verbose) {
+        std::cout << "Results saved to " << filename << std::endl;
     }
+}
+
+void NumericalMethod::saveToBinary(const std::string& filename, const std::string& equationId) const {
+    ScopedPhaseTimer timer(instrumentation, &SolveInstrumentation::setExportSeconds, "saveToBinary");
+    TrajectoryInfo info;
+    info.methodName = getMethodName();
+    info.equationId = equationId;
+    info.x0 = x0;
+    info.stepSize = stepSize;
+    info.stepCount = xValues.empty() ? 0 : xValues.size() - 1;
     
-    file.close();
+    if (dimension > 0) {
+        TrajectoryFile::write(filename, info, xValues.data(), stateValues.data(), xValues.size(), dimension);
+    }
+    else {
+        TrajectoryFile::write(filename, info, xValues.data(), yValues.data(), xValues.size(), 1);
+    }
     
     if (verbose) {
         std::cout << "Results saved to " << filename << std::endl;
@@ -112,6 +424,11 @@ void NumericalMethod::saveToCSV(const std::string& filename) const {
 }
 
 double NumericalMethod::calculateError() const {
+    // Only the final point is known when steps were streamed
+    if (observer) {
+        return std::abs(exactFunction(lastX) - getResult());
+    }
+    
     if (xValues.empty() || yValues.empty()) {
         throw std::runtime_error("Method has not been solved yet");
     }
@@ -119,7 +436,7 @@ double NumericalMethod::calculateError() const {
     double maxError = 0.0;
     
     for (size_t i = 0; i < xValues.size(); ++i) {
-        double exact = exactSolution(xValues[i]);
+        double exact = exactFunction(xValues[i]);
         double error = std::abs(exact - yValues[i]);
         maxError = std::max(maxError, error);
     }
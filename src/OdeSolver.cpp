@@ -0,0 +1,59 @@
+/**
+ * @file OdeSolver.cpp
+ * @brief Implementation of the embedding entry point
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "OdeSolver.h"
+#include "NumericalMethod.h"
+#include "StepObserver.h"
+#include "Utility.h"
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+OdeSolution solveOde(const OdeProblem& problem) {
+    OdeSolution solution;
+    try {
+        if (!(std::abs(problem.stepSize) > 0.0) || std::isinf(problem.stepSize)) {
+            throw std::invalid_argument("Step size must be finite and nonzero");
+        }
+
+        std::unique_ptr<NumericalMethod> method(
+            problem.rhs ? Utility::createMethod(problem.method, problem.rhs)
+                        : Utility::createMethod(problem.method));
+        solution.methodName = method->getMethodName();
+        method->setVerbose(false);
+
+        std::shared_ptr<FinalValueObserver> finalValue;
+        if (!problem.keepTrajectory) {
+            finalValue = std::make_shared<FinalValueObserver>();
+            method->setObserver(finalValue);
+        }
+
+        method->setParameters(problem.x0, problem.y0, problem.xTarget, problem.stepSize);
+        method->solve();
+
+        solution.finalY = method->getResult();
+        if (finalValue) {
+            solution.finalX = finalValue->getX();
+        }
+        else {
+            solution.x = method->getXValues();
+            solution.y = method->getYValues();
+            solution.finalX = solution.x.back();
+        }
+        solution.rhsCalls = method->getSolveStats().rhsCalls;
+        solution.ok = true;
+    }
+    catch (const std::exception& e) {
+        solution = OdeSolution();
+        solution.error = e.what();
+    }
+    catch (...) {
+        solution = OdeSolution();
+        solution.error = "Unknown error";
+    }
+    return solution;
+}
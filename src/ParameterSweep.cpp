@@ -0,0 +1,185 @@
+/**
+ * @file ParameterSweep.cpp
+ * @brief Implementation of the parameter sweep
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "ParameterSweep.h"
+#include "CsvWriter.h"
+#include "StepObserver.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <future>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+size_t SweepGrid::size() const {
+    return x0Values.size() * y0Values.size() * xTargetValues.size() * stepSizes.size();
+}
+
+std::vector<double> SweepGrid::linspace(double first, double last, size_t count) {
+    std::vector<double> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = (count == 1) ? first : first + (last - first) * i / (count - 1);
+    }
+    return values;
+}
+
+ParameterSweep::ParameterSweep(MethodFactory factoryFunc, unsigned threadCount)
+    : factory(factoryFunc), threads(threadCount), chunkSize(0), wallTime(0.0), stealCount(0) {
+    if (!factory) {
+        throw std::invalid_argument("Method factory must not be empty");
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+void ParameterSweep::setGrid(const SweepGrid& gridVal) {
+    grid = gridVal;
+}
+
+void ParameterSweep::setExactSolution(ExactFunction exactFunc) {
+    exact = exactFunc;
+}
+
+void ParameterSweep::setChunkSize(size_t size) {
+    chunkSize = size;
+}
+
+ParameterSweep::PooledMethod ParameterSweep::takeMethod() {
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        if (!idleMethods.empty()) {
+            PooledMethod pooled = std::move(idleMethods.back());
+            idleMethods.pop_back();
+            return pooled;
+        }
+    }
+
+    PooledMethod pooled;
+    pooled.method.reset(factory());
+    pooled.finalValue = std::make_shared<FinalValueObserver>();
+    pooled.method->setVerbose(false);
+    pooled.method->setObserver(pooled.finalValue);
+    return pooled;
+}
+
+void ParameterSweep::returnMethod(PooledMethod& pooled) {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    idleMethods.push_back(std::move(pooled));
+}
+
+void ParameterSweep::solveChunk(size_t begin, size_t end) {
+    PooledMethod pooled = takeMethod();
+    NumericalMethod* method = pooled.method.get();
+    FinalValueObserver* finalValue = pooled.finalValue.get();
+
+    size_t hCount = grid.stepSizes.size();
+    size_t targetCount = grid.xTargetValues.size();
+    size_t y0Count = grid.y0Values.size();
+
+    for (size_t i = begin; i < end; ++i) {
+        // Step size varies fastest, then xTarget, y0 and x0
+        size_t index = i;
+        SweepResult& result = results[i];
+        result.stepSize = grid.stepSizes[index % hCount];
+        index /= hCount;
+        result.xTarget = grid.xTargetValues[index % targetCount];
+        index /= targetCount;
+        result.y0 = grid.y0Values[index % y0Count];
+        index /= y0Count;
+        result.x0 = grid.x0Values[index];
+        result.finalX = std::numeric_limits<double>::quiet_NaN();
+        result.finalY = std::numeric_limits<double>::quiet_NaN();
+        result.error = std::numeric_limits<double>::quiet_NaN();
+
+        try {
+            if (!(std::abs(result.stepSize) > 0.0) || std::isinf(result.stepSize)) {
+                throw std::invalid_argument("Step size must be finite and nonzero");
+            }
+            method->setParameters(result.x0, result.y0, result.xTarget, result.stepSize);
+            method->solve();
+            result.finalX = finalValue->getX();
+            result.finalY = method->getResult();
+            if (exact) {
+                result.error = std::abs(exact(result.x0, result.y0, result.finalX) - result.finalY);
+            }
+        }
+        catch (const std::exception& e) {
+            result.message = e.what();
+        }
+    }
+
+    returnMethod(pooled);
+}
+
+const std::vector<SweepResult>& ParameterSweep::run() {
+    size_t total = grid.size();
+    results.assign(total, SweepResult());
+
+    // Enough chunks per worker for stealing to even out the load
+    size_t chunk = chunkSize;
+    if (chunk == 0) {
+        chunk = std::max<size_t>(1, total / (static_cast<size_t>(threads) * 16));
+    }
+
+    // At most one method per worker is taken at a time
+    idleMethods.reserve(threads);
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        ThreadPool pool(threads);
+        std::vector<std::future<void> > pending;
+        for (size_t begin = 0; begin < total; begin += chunk) {
+            size_t end = std::min(total, begin + chunk);
+            pending.push_back(pool.submit([this, begin, end]() { solveChunk(begin, end); }));
+        }
+
+        // get() rethrows failures of the factory itself
+        for (size_t i = 0; i < pending.size(); ++i) {
+            pending[i].get();
+        }
+        stealCount = pool.getStealCount();
+    }
+    wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return results;
+}
+
+const std::vector<SweepResult>& ParameterSweep::getResults() const {
+    return results;
+}
+
+double ParameterSweep::getWallTime() const {
+    return wallTime;
+}
+
+size_t ParameterSweep::getStealCount() const {
+    return stealCount;
+}
+
+void ParameterSweep::saveToCSV(const std::string& filename) const {
+    std::FILE* file = std::fopen(filename.c_str(), "w");
+    if (file == NULL) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+
+    std::fprintf(file, "x0,y0,xTarget,stepSize,finalX,finalY,error,message\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const SweepResult& r = results[i];
+        std::fprintf(file, "%.17g,%.17g,%.17g,%.17g,%.17g,%.17g,%.17g,%s\n",
+                     r.x0, r.y0, r.xTarget, r.stepSize, r.finalX, r.finalY, r.error,
+                     CsvWriter::quote(r.message).c_str());
+    }
+
+    if (std::fclose(file) != 0) {
+        throw std::runtime_error("Failed to write file: " + filename);
+    }
+}
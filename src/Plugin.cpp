@@ -0,0 +1,138 @@
+/**
+ * @file Plugin.cpp
+ * @brief Implementation of the plugin loader
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "Plugin.h"
+#include "NumericalMethod.h"
+#include "ImplicitMethod.h"
+#include "Utility.h"
+#include <memory>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#else
+#include <windows.h>
+#endif
+
+namespace {
+
+std::string lastError() {
+#ifndef _WIN32
+    const char* message = ::dlerror();
+    return message != NULL ? message : "unknown error";
+#else
+    return "error " + std::to_string(::GetLastError());
+#endif
+}
+
+} // namespace
+
+Plugin::Plugin(const std::string& pluginPath)
+    : path(pluginPath), handle(NULL), rhs(NULL), batchRhs(NULL), exact(NULL), jacobian(NULL) {
+#ifndef _WIN32
+    handle = ::dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+#else
+    handle = reinterpret_cast<void*>(::LoadLibraryA(path.c_str()));
+#endif
+    if (handle == NULL) {
+        throw std::runtime_error("Failed to load plugin " + path + ": " + lastError());
+    }
+
+    // Resolve everything now, so no lookup happens while solving
+    OdePluginAbiVersion version = reinterpret_cast<OdePluginAbiVersion>(lookup("ode_plugin_abi_version"));
+    rhs = reinterpret_cast<OdePluginRhs>(lookup("ode_plugin_rhs"));
+    batchRhs = reinterpret_cast<OdePluginBatchRhs>(lookup("ode_plugin_rhs_batch"));
+    exact = reinterpret_cast<OdePluginExact>(lookup("ode_plugin_exact"));
+    jacobian = reinterpret_cast<OdePluginJacobian>(lookup("ode_plugin_jacobian"));
+
+    const char* problem = NULL;
+    if (version == NULL) {
+        problem = "ode_plugin_abi_version is missing";
+    }
+    else if (version() != ODE_PLUGIN_ABI_VERSION) {
+        problem = "built for a different ODE_PLUGIN_ABI_VERSION";
+    }
+    else if (rhs == NULL) {
+        problem = "ode_plugin_rhs is missing";
+    }
+    if (problem != NULL) {
+        close();
+        throw std::runtime_error("Invalid plugin " + path + ": " + problem);
+    }
+}
+
+Plugin::~Plugin() {
+    close();
+}
+
+void* Plugin::lookup(const char* symbol) const {
+#ifndef _WIN32
+    return ::dlsym(handle, symbol);
+#else
+    return reinterpret_cast<void*>(::GetProcAddress(reinterpret_cast<HMODULE>(handle), symbol));
+#endif
+}
+
+void Plugin::close() {
+    if (handle == NULL) {
+        return;
+    }
+#ifndef _WIN32
+    ::dlclose(handle);
+#else
+    ::FreeLibrary(reinterpret_cast<HMODULE>(handle));
+#endif
+    handle = NULL;
+}
+
+const std::string& Plugin::getPath() const {
+    return path;
+}
+
+OdePluginRhs Plugin::getRhs() const {
+    return rhs;
+}
+
+BatchFunction Plugin::getBatchRhs() const {
+    if (batchRhs != NULL) {
+        return batchRhs;
+    }
+    OdePluginRhs f = rhs;
+    return [f](size_t count, const double* x, const double* y, double* dydx) {
+        for (size_t i = 0; i < count; ++i) {
+            dydx[i] = f(x[i], y[i]);
+        }
+    };
+}
+
+bool Plugin::hasExactSolution() const {
+    return exact != NULL;
+}
+
+OdePluginExact Plugin::getExactSolution() const {
+    return exact;
+}
+
+bool Plugin::hasJacobian() const {
+    return jacobian != NULL;
+}
+
+OdePluginJacobian Plugin::getJacobian() const {
+    return jacobian;
+}
+
+NumericalMethod* Plugin::createMethod(const std::string& name) const {
+    std::unique_ptr<NumericalMethod> method(Utility::createMethod(name, rhs));
+    if (exact != NULL) {
+        method->setExactSolution(exact);
+    }
+    ImplicitMethod* implicit = dynamic_cast<ImplicitMethod*>(method.get());
+    if (implicit != NULL && jacobian != NULL) {
+        implicit->setJacobian(jacobian);
+    }
+    return method.release();
+}
@@ -6,10 +6,12 @@
  */
 
 #include "RungeKutta2.h"
+#include "StaticSolver.h"
+#include "PrecisionPolicy.h"
 #include <iostream>
 #include <iomanip>
-#include <chrono>
-#include <thread>
+#include <cmath>
+#include <algorithm>
 
 RungeKutta2::RungeKutta2(std::function<double(double, double)> diffFunc) 
     : NumericalMethod(diffFunc) {}
@@ -19,78 +21,112 @@ void RungeKutta2::solve() {
     double x = x0;
     double y = y0;
     
+    std::ostream& out = traceStream();
+    
+    beginSolve();
+    
     if (verbose) {
-        std::cout << "\n=== 2nd Order Runge-Kutta Method ===" << std::endl;
-        std::cout << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0 
-                  << ", y0 = " << y0 << std::endl;
-        std::cout << "Step size: h = " << stepSize << std::endl;
-        std::cout << "Target x: " << xTarget << std::endl;
+        out << "\n=== 2nd Order Runge-Kutta Method ===" << std::endl;
+        out << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0 
+            << ", y0 = " << y0 << std::endl;
+        out << "Step size: h = " << stepSize << std::endl;
+        out << "Target x: " << xTarget << std::endl;
+        beginTrace(formatRungeKutta2Step);
     }
     
+    double k[RungeKutta2Stepper::stages];
+    
+    // Counts the calls the stepper makes
+    auto rhs = countCalls(diffFunction, instrumentation);
+    
     // Solve step by step
     for (int i = 0; i < steps; ++i) {
-        if (verbose) {
-            std::cout << "\nStep " << (i + 1) << ":" << std::endl;
-            std::cout << "At x = " << std::fixed << std::setprecision(4) << x 
-                      << ", y = " << y << std::endl;
-        }
+        PhaseSample sample(instrumentation);
         
-        // Calculate k1 and k2
-        double k1 = stepSize * diffFunction(x, y);
-        double k2 = stepSize * diffFunction(x + stepSize, y + k1);
+        double xStart = x, yStart = y;
         
-        // Calculate delta k and next y
-        double deltaK = 0.5 * (k1 + k2);
+        // Calculate k1, k2, delta k and next y
+        double deltaK = RungeKutta2Stepper::step(rhs, x, y, stepSize, k);
         
-        // Round to 4 decimal places
-        k1 = std::round(k1 * 10000.0) / 10000.0;
-        k2 = std::round(k2 * 10000.0) / 10000.0;
-        deltaK = std::round(deltaK * 10000.0) / 10000.0;
+        sample.enter(SolvePhase::Rounding);
+        // Round to 4 decimal places in classroom precision
+        deltaK = PrecisionPolicy::apply(deltaK);
         
         // Update values
         x += stepSize;
         y += deltaK;
         
-        // Round to 4 decimal places
-        y = std::round(y * 10000.0) / 10000.0;
+        // Round to 4 decimal places in classroom precision
+        y = PrecisionPolicy::apply(y);
         
         // Store values
-        xValues.push_back(x);
-        yValues.push_back(y);
+        sample.enter(SolvePhase::Storage);
+        recordStep(x, y);
+        sample.enter(SolvePhase::None);
         
         if (verbose) {
-            std::cout << "k1 = " << k1 << std::endl;
-            std::cout << "k2 = " << k2 << std::endl;
-            std::cout << "delta k = " << deltaK << std::endl;
-            std::cout << "New y = " << y << " at x = " << std::fixed << std::setprecision(4) << x << std::endl;
-            
-            if (compareExact) {
-                double exact = exactSolution(x);
-                // Round to 4 decimal places
-                exact = std::round(exact * 10000.0) / 10000.0;
-                double error = std::abs(exact - y);
-                std::cout << "Exact solution: " << exact << std::endl;
-                std::cout << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
-            }
-            
-            // Add small delay for better user experience
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            StepRecord record;
+            record.step = i + 1;
+            record.xStart = xStart;
+            record.yStart = yStart;
+            record.x = x;
+            record.y = y;
+            record.k[0] = k[0];
+            record.k[1] = k[1];
+            record.increment = deltaK;
+            record.h = stepSize;
+            traceStep(record);
         }
     }
     
+    endSolve();
+    endTrace();
+    
     if (verbose) {
-        std::cout << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget 
-                  << ": y = " << y << std::endl;
+        out << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget 
+            << ": y = " << y << std::endl;
         
         if (compareExact) {
-            double exact = exactSolution(xTarget);
+            double exact = exactFunction(xTarget);
             // Round to 4 decimal places
             exact = std::round(exact * 10000.0) / 10000.0;
             double error = std::abs(exact - y);
-            std::cout << "Exact solution: " << exact << std::endl;
-            std::cout << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
+            out << "Exact solution: " << exact << std::endl;
+            out << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
+        }
+    }
+}
+
+void RungeKutta2::solveSystem() {
+    checkSystemReady();
+    const size_t n = dimension;
+    
+    // State, stage slopes and stage state, from the reused workspace
+    double* y = solveWorkspace().allocate(4 * n);
+    double* k1 = y + n;
+    double* k2 = k1 + n;
+    double* yStage = k2 + n;
+    
+    std::copy(initialState.begin(), initialState.end(), y);
+    double x = x0;
+    
+    auto rhs = countCalls(systemFunction, instrumentation);
+    beginSolve();
+    for (int i = 0; i < steps; ++i) {
+        rhs(x, y, k1);
+        addScaled(n, y, stepSize, k1, yStage);
+        rhs(x + stepSize, yStage, k2);
+        
+        for (size_t j = 0; j < n; ++j) {
+            y[j] += 0.5 * stepSize * (k1[j] + k2[j]);
         }
+        x += stepSize;
+        
+        storeState(x, y);
     }
+    
+    printSystemSummary();
+    endSolve();
 }
 
 std::string RungeKutta2::getMethodName() const {
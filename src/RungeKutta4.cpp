@@ -6,97 +6,159 @@
  */
 
 #include "RungeKutta4.h"
+#include "StaticSolver.h"
+#include "PrecisionPolicy.h"
 #include <iostream>
 #include <iomanip>
-#include <chrono>
-#include <thread>
+#include <cmath>
+#include <algorithm>
 
 RungeKutta4::RungeKutta4(std::function<double(double, double)> diffFunc) 
-    : NumericalMethod(diffFunc) {}
+    : NumericalMethod(diffFunc) {
+    // k1..k4 of each step
+    denseStride = RungeKutta4Stepper::stages;
+}
 
 void RungeKutta4::solve() {
     // Start with initial values (already in vectors)
     double x = x0;
     double y = y0;
     
+    std::ostream& out = traceStream();
+    
+    beginSolve();
+    
     if (verbose) {
-        std::cout << "\n=== 4th Order Runge-Kutta Method ===" << std::endl;
-        std::cout << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0 
-                  << ", y0 = " << y0 << std::endl;
-        std::cout << "Step size: h = " << stepSize << std::endl;
-        std::cout << "Target x: " << xTarget << std::endl;
+        out << "\n=== 4th Order Runge-Kutta Method ===" << std::endl;
+        out << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0 
+            << ", y0 = " << y0 << std::endl;
+        out << "Step size: h = " << stepSize << std::endl;
+        out << "Target x: " << xTarget << std::endl;
+        beginTrace(formatRungeKutta4Step);
     }
     
+    double k[RungeKutta4Stepper::stages];
+    
+    // Counts the calls the stepper makes
+    auto rhs = countCalls(diffFunction, instrumentation);
+    
     // Solve step by step
     for (int i = 0; i < steps; ++i) {
-        if (verbose) {
-            std::cout << "\nStep " << (i + 1) << ":" << std::endl;
-            std::cout << "At x = " << std::fixed << std::setprecision(4) << x 
-                      << ", y = " << y << std::endl;
-        }
+        PhaseSample sample(instrumentation);
         
-        // Calculate k1, k2, k3, and k4
-        double k1 = stepSize * diffFunction(x, y);
-        double k2 = stepSize * diffFunction(x + 0.5 * stepSize, y + 0.5 * k1);
-        double k3 = stepSize * diffFunction(x + 0.5 * stepSize, y + 0.5 * k2);
-        double k4 = stepSize * diffFunction(x + stepSize, y + k3);
+        double xStart = x, yStart = y;
         
-        // Calculate delta k and next y
-        double deltaK = (k1 + 2.0 * k2 + 2.0 * k3 + k4) / 6.0;
+        // Calculate k1, k2, k3, k4, delta k and next y
+        double deltaK = RungeKutta4Stepper::step(rhs, x, y, stepSize, k);
         
-        // Round to 4 decimal places
-        k1 = std::round(k1 * 10000.0) / 10000.0;
-        k2 = std::round(k2 * 10000.0) / 10000.0;
-        k3 = std::round(k3 * 10000.0) / 10000.0;
-        k4 = std::round(k4 * 10000.0) / 10000.0;
-        deltaK = std::round(deltaK * 10000.0) / 10000.0;
+        if (denseOutput) {
+            denseValues.insert(denseValues.end(), k, k + RungeKutta4Stepper::stages);
+        }
+        
+        sample.enter(SolvePhase::Rounding);
+        // Round to 4 decimal places in classroom precision
+        deltaK = PrecisionPolicy::apply(deltaK);
         
         // Update values
         x += stepSize;
         y += deltaK;
         
-        // Round to 4 decimal places
-        y = std::round(y * 10000.0) / 10000.0;
+        // Round to 4 decimal places in classroom precision
+        y = PrecisionPolicy::apply(y);
         
         // Store values
-        xValues.push_back(x);
-        yValues.push_back(y);
+        sample.enter(SolvePhase::Storage);
+        recordStep(x, y);
+        sample.enter(SolvePhase::None);
         
         if (verbose) {
-            std::cout << "k1 = " << k1 << std::endl;
-            std::cout << "k2 = " << k2 << std::endl;
-            std::cout << "k3 = " << k3 << std::endl;
-            std::cout << "k4 = " << k4 << std::endl;
-            std::cout << "delta k = " << deltaK << std::endl;
-            std::cout << "New y = " << y << " at x = " << std::fixed << std::setprecision(4) << x << std::endl;
-            
-            if (compareExact) {
-                double exact = exactSolution(x);
-                // Round to 4 decimal places
-                exact = std::round(exact * 10000.0) / 10000.0;
-                double error = std::abs(exact - y);
-                std::cout << "Exact solution: " << exact << std::endl;
-                std::cout << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
-            }
-            
-            // Add small delay for better user experience
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            StepRecord record;
+            record.step = i + 1;
+            record.xStart = xStart;
+            record.yStart = yStart;
+            record.x = x;
+            record.y = y;
+            record.k[0] = k[0];
+            record.k[1] = k[1];
+            record.k[2] = k[2];
+            record.k[3] = k[3];
+            record.increment = deltaK;
+            record.h = stepSize;
+            traceStep(record);
         }
     }
     
+    endSolve();
+    endTrace();
+    
     if (verbose) {
-        std::cout << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget 
-                  << ": y = " << y << std::endl;
+        out << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget 
+            << ": y = " << y << std::endl;
         
         if (compareExact) {
-            double exact = exactSolution(xTarget);
+            double exact = exactFunction(xTarget);
             // Round to 4 decimal places
             exact = std::round(exact * 10000.0) / 10000.0;
             double error = std::abs(exact - y);
-            std::cout << "Exact solution: " << exact << std::endl;
-            std::cout << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
+            out << "Exact solution: " << exact << std::endl;
+            out << "Error: " << std::fixed << std::setprecision(4) << error << std::endl;
+        }
+    }
+}
+
+void RungeKutta4::solveSystem() {
+    checkSystemReady();
+    const size_t n = dimension;
+    
+    // State, k1..k4 and stage state, from the reused workspace
+    double* y = solveWorkspace().allocate(6 * n);
+    double* k1 = y + n;
+    double* k2 = k1 + n;
+    double* k3 = k2 + n;
+    double* k4 = k3 + n;
+    double* yStage = k4 + n;
+    
+    std::copy(initialState.begin(), initialState.end(), y);
+    double x = x0;
+    const double halfStep = 0.5 * stepSize;
+    
+    auto rhs = countCalls(systemFunction, instrumentation);
+    beginSolve();
+    for (int i = 0; i < steps; ++i) {
+        rhs(x, y, k1);
+        addScaled(n, y, halfStep, k1, yStage);
+        rhs(x + halfStep, yStage, k2);
+        addScaled(n, y, halfStep, k2, yStage);
+        rhs(x + halfStep, yStage, k3);
+        addScaled(n, y, stepSize, k3, yStage);
+        rhs(x + stepSize, yStage, k4);
+        
+        for (size_t j = 0; j < n; ++j) {
+            y[j] += stepSize * (k1[j] + 2.0 * k2[j] + 2.0 * k3[j] + k4[j]) / 6.0;
         }
+        x += stepSize;
+        
+        storeState(x, y);
     }
+    
+    printSystemSummary();
+    endSolve();
+}
+
+double RungeKutta4::interpolateStep(size_t i, double theta) const {
+    if (denseValues.size() < (i + 1) * denseStride) {
+        return NumericalMethod::interpolateStep(i, theta);
+    }
+    
+    // Continuous extension of the classical RK4 tableau (3rd order)
+    const double* k = &denseValues[i * denseStride];
+    double theta2 = theta * theta;
+    double theta3 = theta2 * theta;
+    double b1 = theta - 1.5 * theta2 + 2.0 * theta3 / 3.0;
+    double b23 = theta2 - 2.0 * theta3 / 3.0;
+    double b4 = -0.5 * theta2 + 2.0 * theta3 / 3.0;
+    
+    return yValues[i] + b1 * k[0] + b23 * (k[1] + k[2]) + b4 * k[3];
 }
 
 std::string RungeKutta4::getMethodName() const {
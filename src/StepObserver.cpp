@@ -0,0 +1,158 @@
+/**
+ * @file StepObserver.cpp
+ * @brief Implementation of the step observer sinks
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "StepObserver.h"
+#include <stdexcept>
+
+namespace {
+
+// Size of the stdio buffer used by FileObserver
+const size_t FILE_BUFFER_SIZE = 1 << 20;
+
+} // namespace
+
+FinalValueObserver::FinalValueObserver() : lastX(0.0) {}
+
+void FinalValueObserver::observe(double x, const double* y, size_t n) {
+    lastX = x;
+    lastState.assign(y, y + n);
+}
+
+double FinalValueObserver::getX() const {
+    return lastX;
+}
+
+const std::vector<double>& FinalValueObserver::getState() const {
+    return lastState;
+}
+
+void VectorObserver::begin(const std::string& methodName, long expectedSteps) {
+    (void)methodName;
+    xValues.clear();
+    values.clear();
+    if (expectedSteps > 0) {
+        xValues.reserve(expectedSteps + 1);
+    }
+}
+
+void VectorObserver::observe(double x, const double* y, size_t n) {
+    xValues.push_back(x);
+    values.insert(values.end(), y, y + n);
+}
+
+const std::vector<double>& VectorObserver::getXValues() const {
+    return xValues;
+}
+
+const std::vector<double>& VectorObserver::getValues() const {
+    return values;
+}
+
+CallbackObserver::CallbackObserver(Callback func) : callback(func) {}
+
+void CallbackObserver::observe(double x, const double* y, size_t n) {
+    callback(x, y, n);
+}
+
+BufferedObserver::BufferedObserver(size_t capacityVal, FlushFunction flushFunc)
+    : capacity(capacityVal), count(0), dimension(0), flush(flushFunc) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Buffer capacity must be positive");
+    }
+}
+
+void BufferedObserver::observe(double x, const double* y, size_t n) {
+    if (n != dimension) {
+        flushBuffer();
+        dimension = n;
+        xBuffer.resize(capacity);
+        yBuffer.resize(capacity * n);
+    }
+
+    xBuffer[count] = x;
+    for (size_t j = 0; j < n; ++j) {
+        yBuffer[count * n + j] = y[j];
+    }
+
+    if (++count == capacity) {
+        flushBuffer();
+    }
+}
+
+void BufferedObserver::end() {
+    flushBuffer();
+}
+
+void BufferedObserver::flushBuffer() {
+    if (count > 0) {
+        flush(xBuffer.data(), yBuffer.data(), count, dimension);
+        count = 0;
+    }
+}
+
+FileObserver::FileObserver(const std::string& filename)
+    : filename(filename), file(std::fopen(filename.c_str(), "w")), buffer(FILE_BUFFER_SIZE),
+      headerWritten(false), written(false) {
+    if (file == NULL) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+    std::setvbuf(file, buffer.data(), _IOFBF, buffer.size());
+}
+
+FileObserver::~FileObserver() {
+    if (file != NULL) {
+        std::fclose(file);
+    }
+}
+
+void FileObserver::begin(const std::string& methodName, long expectedSteps) {
+    (void)methodName;
+    (void)expectedSteps;
+
+    // Every solve replaces the trajectory of the previous one. The old
+    // stream is kept until the file is open again, so a failure leaves
+    // the observer writing to a valid stream
+    if (written) {
+        std::fflush(file);
+        FILE* reopened = std::fopen(filename.c_str(), "w");
+        if (reopened == NULL) {
+            throw std::runtime_error("Failed to reopen file: " + filename);
+        }
+        std::fclose(file);
+        file = reopened;
+        std::setvbuf(file, buffer.data(), _IOFBF, buffer.size());
+        written = false;
+    }
+    headerWritten = false;
+}
+
+void FileObserver::observe(double x, const double* y, size_t n) {
+    if (!headerWritten) {
+        std::fputs("x", file);
+        if (n == 1) {
+            std::fputs(",y", file);
+        }
+        else {
+            for (size_t j = 0; j < n; ++j) {
+                std::fprintf(file, ",y%zu", j);
+            }
+        }
+        std::fputc('\n', file);
+        headerWritten = true;
+        written = true;
+    }
+
+    std::fprintf(file, "%.17g", x);
+    for (size_t j = 0; j < n; ++j) {
+        std::fprintf(file, ",%.17g", y[j]);
+    }
+    std::fputc('\n', file);
+}
+
+void FileObserver::end() {
+    std::fflush(file);
+}
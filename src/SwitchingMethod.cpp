@@ -0,0 +1,242 @@
+/**
+ * @file SwitchingMethod.cpp
+ * @brief Implementation of the Dormand-Prince/BDF switching solver
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "SwitchingMethod.h"
+#include "DormandPrinceTableau.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+// Stiffness detection (after Hairer & Wanner, Solving ODEs II, IV.2)
+// The stability region reaches 3.3 on the negative axis; the step controller
+// settles at about 2.9 when stability limits the step
+const double STABILITY_LIMIT = 2.5;
+const int STIFF_STEPS = 15;             // Steps near the edge before switching to BDF
+const int NON_STIFF_RESET = 6;          // Steps inside the region that clear the count
+const int CHECK_INTERVAL = 10;          // BDF steps between checks of J
+const int NON_STIFF_CHECKS = 2;         // Checks inside the region before switching back
+
+} // namespace
+
+SwitchingMethod::SwitchingMethod(std::function<double(double, double)> diffFunc)
+    : BDF(diffFunc), stepsSinceCheck(0), nonStiffChecks(0) {
+}
+
+void SwitchingMethod::solve() {
+    BDF::solve();
+    if (verbose) {
+        printPhases(traceStream());
+    }
+}
+
+void SwitchingMethod::solveSystem() {
+    BDF::solveSystem();
+    if (verbose) {
+        printPhases(traceStream());
+    }
+}
+
+void SwitchingMethod::integrate(double* y) {
+    phases.clear();
+
+    // Integrate towards xTarget whatever the sign of stepSize; both phases keep h signed
+    const double dir = (xTarget >= x0) ? 1.0 : -1.0;
+    double x = x0;
+    double h = dir * std::min(std::abs(stepSize), dir * (xTarget - x0));
+    bool stiff = false;
+
+    // The buffers of both methods, shared by all phases
+    const size_t n = size;
+    const StepBuffers implicitWork = stepBuffers();
+    ExplicitBuffers explicitWork;
+    explicitWork.k = scratch(7 * n);
+    explicitWork.stage = scratch(n);
+    explicitWork.lastStage = scratch(n);
+    explicitWork.yNew = scratch(n);
+    explicitWork.error = scratch(n);
+
+    while (dir * (xTarget - x) > 0.0) {
+        Phase phase;
+        phase.stiff = stiff;
+        phase.xStart = x;
+        int startSteps = acceptedSteps;
+        long startEvaluations = evaluations;
+        long startJacobians = jacobianEvaluations;
+        long startFactorizations = factorizations;
+
+        if (stiff) {
+            stepsSinceCheck = 0;
+            nonStiffChecks = 0;
+            advance(x, y, h, implicitWork);
+        }
+        else {
+            advanceExplicit(x, y, h, explicitWork);
+        }
+
+        phase.xEnd = x;
+        phase.steps = acceptedSteps - startSteps;
+        phase.evaluations = evaluations - startEvaluations;
+        phase.jacobianEvaluations = jacobianEvaluations - startJacobians;
+        phase.factorizations = factorizations - startFactorizations;
+        phases.push_back(phase);
+        stiff = !stiff;
+    }
+}
+
+void SwitchingMethod::advanceExplicit(double& x, double* y, double& h, const ExplicitBuffers& work) {
+    const size_t n = size;
+    double* k = work.k;
+    double* stage = work.stage;
+    double* lastStage = work.lastStage;
+    double* yNew = work.yNew;
+    double* error = work.error;
+
+    double errOld = 1e-4;
+    bool lastRejected = false;
+    int stiffSteps = 0;
+    int nonStiffSteps = 0;
+
+    // h carries the direction of integration; lengths are compared with dir * h
+    const double dir = (h >= 0.0) ? 1.0 : -1.0;
+
+    // First stage, reused from the previous accepted step afterwards (FSAL)
+    evaluate(x, y, k);
+
+    while (dir * (xTarget - x) > 0.0) {
+        PhaseSample sample(instrumentation);
+
+        if (acceptedSteps + rejectedSteps >= DormandPrinceTableau::MAX_STEPS) {
+            throw std::runtime_error("Switching method: maximum number of steps exceeded");
+        }
+
+        // Do not step past the target
+        bool lastStep = false;
+        if (dir * h >= dir * (xTarget - x)) {
+            h = xTarget - x;
+            lastStep = true;
+        }
+        if (dir * h <= std::abs(x) * 1e-15) {
+            throw std::runtime_error("Switching method: step size underflow");
+        }
+
+        for (int s = 0; s < 6; ++s) {
+            double* target = (s == 4) ? lastStage : (s == 5) ? yNew : stage;
+            for (size_t i = 0; i < n; ++i) {
+                double sum = 0.0;
+                for (int j = 0; j <= s; ++j) {
+                    sum += DormandPrinceTableau::A[s][j] * k[j * n + i];
+                }
+                target[i] = y[i] + h * sum;
+            }
+            evaluate(x + DormandPrinceTableau::C[s] * h, target, k + (s + 1) * n);
+        }
+
+        // Error of the embedded 4th order solution
+        for (size_t i = 0; i < n; ++i) {
+            double sum = 0.0;
+            for (int j = 0; j < 7; ++j) {
+                sum += DormandPrinceTableau::E[j] * k[j * n + i];
+            }
+            error[i] = h * sum;
+        }
+        double err = tolerances.scaledNorm(n, error, y, yNew);
+        double errFactor = std::pow(std::max(err, 1e-10), DormandPrinceTableau::ALPHA);
+
+        if (err > 1.0) {
+            // Reject the step and retry with a smaller one
+            ++rejectedSteps;
+            lastRejected = true;
+            h *= std::max(DormandPrinceTableau::MIN_FACTOR, DormandPrinceTableau::SAFETY / errFactor);
+            traceRejected(x, y, h);
+            continue;
+        }
+
+        double factor = DormandPrinceTableau::SAFETY
+                        / (errFactor * std::pow(errOld, -DormandPrinceTableau::BETA));
+        factor = std::min(DormandPrinceTableau::MAX_FACTOR,
+                          std::max(DormandPrinceTableau::MIN_FACTOR, factor));
+        if (lastRejected) {
+            factor = std::min(1.0, factor);
+        }
+        errOld = std::max(err, 1e-4);
+        lastRejected = false;
+
+        // Dominant eigenvalue from the last two stages, both at x + h
+        double numerator = 0.0;
+        double denominator = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            double df = k[6 * n + i] - k[5 * n + i];
+            double dy = yNew[i] - lastStage[i];
+            numerator += df * df;
+            denominator += dy * dy;
+        }
+        bool switchToImplicit = false;
+        if (denominator > 0.0 && dir * h * std::sqrt(numerator / denominator) > STABILITY_LIMIT) {
+            nonStiffSteps = 0;
+            switchToImplicit = ++stiffSteps >= STIFF_STEPS;
+        }
+        else if (++nonStiffSteps >= NON_STIFF_RESET) {
+            stiffSteps = 0;
+        }
+
+        double xStart = x;
+        x = lastStep ? xTarget : x + h;
+        std::copy(yNew, yNew + n, y);
+        std::copy(k + 6 * n, k + 7 * n, k);
+
+        sample.enter(SolvePhase::Storage);
+        acceptStep(xStart, x, y, h, std::abs(error[0]));
+        sample.enter(SolvePhase::None);
+
+        h *= factor;
+        if (switchToImplicit) {
+            break;
+        }
+    }
+}
+
+bool SwitchingMethod::stopAfterStep(double x, const double* y, double h) {
+    if (++stepsSinceCheck < CHECK_INTERVAL) {
+        return false;
+    }
+    stepsSinceCheck = 0;
+
+    if (std::abs(h) * jacobianNorm(x, y) > STABILITY_LIMIT) {
+        nonStiffChecks = 0;
+        return false;
+    }
+    return ++nonStiffChecks >= NON_STIFF_CHECKS;
+}
+
+const std::vector<SwitchingMethod::Phase>& SwitchingMethod::getPhases() const {
+    return phases;
+}
+
+void SwitchingMethod::printPhases(std::ostream& out) const {
+    out << "\n=== Phases ===" << std::endl;
+    out << std::left << std::setw(16) << "Method" << std::right << std::setw(14) << "From"
+        << std::setw(14) << "To" << std::setw(10) << "Steps" << std::setw(10) << "f calls"
+        << std::setw(11) << "Jacobians" << std::setw(8) << "LU" << std::endl;
+
+    for (size_t i = 0; i < phases.size(); ++i) {
+        const Phase& phase = phases[i];
+        out << std::left << std::setw(16) << (phase.stiff ? "BDF" : "Dormand-Prince") << std::right
+            << std::fixed << std::setprecision(4) << std::setw(14) << phase.xStart << std::setw(14)
+            << phase.xEnd << std::setw(10) << phase.steps << std::setw(10) << phase.evaluations
+            << std::setw(11) << phase.jacobianEvaluations << std::setw(8) << phase.factorizations
+            << std::endl;
+    }
+    out << "Switches: " << (phases.empty() ? 0 : phases.size() - 1) << std::endl;
+}
+
+std::string SwitchingMethod::getMethodName() const {
+    return "Dormand-Prince/BDF Switching Method";
+}
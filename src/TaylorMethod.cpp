@@ -0,0 +1,194 @@
+/**
+ * @file TaylorMethod.cpp
+ * @brief Implementation of the Taylor series method
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "TaylorMethod.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+const int MAX_STEPS = 10000000;
+
+// Safety factor exp(-0.7 / (p - 1)) of Jorba & Zou, for p > 1
+double stepSafety(int order) {
+    return order > 1 ? std::exp(-0.7 / (order - 1)) : 0.5;
+}
+
+} // namespace
+
+TaylorMethod::TaylorMethod(int order)
+    : NumericalMethod(differentialFunction), jetFunction(DefaultEquation()) {
+    initialize(order);
+}
+
+void TaylorMethod::initialize(int orderVal) {
+    jetEvaluations = 0;
+    setOrder(orderVal);
+}
+
+void TaylorMethod::setOrder(int orderVal) {
+    if (orderVal < 1 || orderVal > Jet::MAX_DEGREE) {
+        throw std::invalid_argument("Taylor order must be between 1 and " + std::to_string(Jet::MAX_DEGREE));
+    }
+    order = orderVal;
+    series.assign(order + 1, 0.0);
+}
+
+int TaylorMethod::getOrder() const {
+    return order;
+}
+
+void TaylorMethod::setTolerances(double absTol, double relTol) {
+    tolerances.set(absTol, relTol);
+}
+
+void TaylorMethod::expand(double x, double y) {
+    // Coefficient k of f(x + t, y(x + t)) depends on y_0 .. y_k only, so
+    // each pass evaluates f on one more coefficient and fixes y_(k+1).
+    // Both arguments carry k + 1 coefficients, or functions of x alone
+    // would be truncated early
+    Jet xJet(x);
+    Jet yJet(y);
+    series[0] = y;
+    for (int k = 0; k < order; ++k) {
+        xJet.resize(k + 1);
+        yJet.resize(k + 1);
+        if (k == 1) {
+            xJet[1] = 1.0;
+        }
+        yJet[k] = series[k];
+        // A constant f has fewer coefficients; the const operator[] gives 0
+        const Jet f = jetFunction(xJet, yJet);
+        series[k + 1] = f[k] / (k + 1);
+    }
+    jetEvaluations += order;
+}
+
+double TaylorMethod::chooseStep(double y) const {
+    // The root test on the last two coefficients estimates the radius of
+    // convergence rho; the terms of degree p - 1 and p fall below the
+    // tolerance at h = rho * tolerance^(1/p)
+    double tolerance = tolerances.scale(y, y);
+    double h = std::numeric_limits<double>::infinity();
+    for (int k = std::max(1, order - 1); k <= order; ++k) {
+        double size = std::abs(series[k]);
+        if (size > 0.0) {
+            h = std::min(h, std::pow(tolerance / size, 1.0 / k));
+        }
+    }
+    return h * stepSafety(order);
+}
+
+void TaylorMethod::solve() {
+    std::ostream& out = traceStream();
+
+    beginSolve();
+
+    if (verbose) {
+        out << "\n=== " << getMethodName() << " ===" << std::endl;
+        out << "Initial values: x0 = " << std::fixed << std::setprecision(4) << x0
+            << ", y0 = " << y0 << std::endl;
+        tolerances.print(out);
+        out << "Target x: " << std::fixed << std::setprecision(4) << xTarget << std::endl;
+        beginTrace(formatDormandPrinceStep);
+    }
+
+    // Integrate towards xTarget; the series holds for steps of either sign
+    const double dir = (xTarget >= x0) ? 1.0 : -1.0;
+    double x = x0;
+    double y = y0;
+    int taken = 0;
+    jetEvaluations = 0;
+
+    while (dir * (xTarget - x) > 0.0) {
+        PhaseSample sample(instrumentation);
+
+        if (taken >= MAX_STEPS) {
+            throw std::runtime_error("Taylor: maximum number of steps exceeded");
+        }
+
+        expand(x, y);
+        double length = chooseStep(y);
+
+        // Do not step past the target
+        bool lastStep = false;
+        if (length >= dir * (xTarget - x)) {
+            length = dir * (xTarget - x);
+            lastStep = true;
+        }
+        if (!(length > std::abs(x) * 1e-15)) {
+            throw std::runtime_error("Taylor: step size underflow");
+        }
+        const double h = dir * length;
+
+        // Sum the series by Horner's rule
+        double yNew = series[order];
+        for (int k = order - 1; k >= 0; --k) {
+            yNew = yNew * h + series[k];
+        }
+        if (!std::isfinite(yNew)) {
+            throw std::runtime_error("Taylor: solution is not finite");
+        }
+
+        double xStart = x;
+        x = lastStep ? xTarget : x + h;
+        y = yNew;
+        ++taken;
+
+        sample.enter(SolvePhase::Storage);
+        recordStep(x, y);
+        sample.enter(SolvePhase::None);
+
+        if (verbose) {
+            StepRecord record;
+            record.step = taken;
+            record.xStart = xStart;
+            record.x = x;
+            record.y = y;
+            record.h = h;
+            record.errorEstimate = std::abs(series[order]) * std::pow(length, order);
+            traceStep(record);
+        }
+    }
+
+    steps = taken;
+
+    // Every Jet evaluation is already counted
+    instrumentation.countCalls(jetEvaluations);
+    endSolve();
+    endTrace();
+
+    if (verbose) {
+        out << "\nFinal result at x = " << std::fixed << std::setprecision(4) << xTarget
+            << ": y = " << getResult() << std::endl;
+        out << "Steps: " << steps << ", Jet evaluations: " << jetEvaluations << std::endl;
+
+        if (compareExact) {
+            double exact = exactFunction(xTarget);
+            double error = std::abs(exact - getResult());
+            out << "Exact solution: " << exact << std::endl;
+            out << "Error: " << std::scientific << std::setprecision(2) << error << std::endl;
+            out << std::fixed << std::setprecision(4);
+        }
+    }
+}
+
+long TaylorMethod::getJetEvaluations() const {
+    return jetEvaluations;
+}
+
+int TaylorMethod::getSteps() const {
+    return steps;
+}
+
+std::string TaylorMethod::getMethodName() const {
+    return "Taylor Series Method (order " + std::to_string(order) + ")";
+}
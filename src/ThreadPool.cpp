@@ -0,0 +1,117 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of the work-stealing thread pool
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace {
+
+// Pool and queue index of the worker running on this thread
+thread_local const ThreadPool* currentPool = NULL;
+thread_local size_t currentIndex = 0;
+
+} // namespace
+
+ThreadPool::ThreadPool(unsigned threads)
+    : pending(0), nextQueue(0), steals(0), stopping(false) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    queues.reserve(threads);
+    for (unsigned i = 0; i < threads; ++i) {
+        queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+    }
+
+    workers.reserve(threads);
+    for (unsigned i = 0; i < threads; ++i) {
+        workers.push_back(std::thread(&ThreadPool::workerLoop, this, static_cast<size_t>(i)));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    available.notify_all();
+
+    for (size_t i = 0; i < workers.size(); ++i) {
+        workers[i].join();
+    }
+}
+
+size_t ThreadPool::size() const {
+    return workers.size();
+}
+
+size_t ThreadPool::getStealCount() const {
+    return steals.load();
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    size_t index = (currentPool == this) ? currentIndex : nextQueue++ % queues.size();
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(task);
+    }
+    pending++;
+
+    // Taking the lock orders the increment before a sleeping worker's check
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    available.notify_one();
+}
+
+bool ThreadPool::takeTask(size_t index, std::function<void()>& task) {
+    // Newest task of our own queue first
+    {
+        WorkerQueue& own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = own.tasks.back();
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // Then the oldest task of another worker
+    for (size_t k = 1; k < queues.size(); ++k) {
+        WorkerQueue& victim = *queues[(index + k) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            steals++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(size_t index) {
+    currentPool = this;
+    currentIndex = index;
+
+    for (;;) {
+        std::function<void()> task;
+        if (takeTask(index, task)) {
+            pending--;
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        available.wait(lock, [this]() { return stopping || pending.load() > 0; });
+
+        // Drain the queues before stopping
+        if (stopping && pending.load() == 0) {
+            return;
+        }
+    }
+}
@@ -0,0 +1,177 @@
+/**
+ * @file TracePipeline.cpp
+ * @brief Implementation of the verbose trace pipeline and the step formatters
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "TracePipeline.h"
+#include "NumericalMethod.h"
+#include "PrecisionPolicy.h"
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+// Beyond this many queued records the reader cannot keep up anyway, so
+// the consumer catches up without pausing
+const size_t PACED_BACKLOG = 64;
+
+} // namespace
+
+TracePipeline::TracePipeline(size_t capacity)
+    : buffer(capacity), producing(false), output(NULL), formatter(NULL),
+      compareExact(false), delay(0) {
+}
+
+TracePipeline::~TracePipeline() {
+    finish();
+}
+
+void TracePipeline::start(std::ostream& out, StepFormatter formatterFunc, bool compareExactVal,
+                          int delayMillis) {
+    finish();
+
+    output = &out;
+    formatter = formatterFunc;
+    compareExact = compareExactVal;
+    delay = delayMillis;
+    producing.store(true, std::memory_order_release);
+    consumer = std::thread(&TracePipeline::consume, this);
+}
+
+void TracePipeline::push(const StepRecord& record) {
+    // Only wait when a whole buffer ahead of the consumer
+    while (!buffer.tryPush(record)) {
+        std::this_thread::yield();
+    }
+}
+
+void TracePipeline::finish() {
+    if (!consumer.joinable()) {
+        return;
+    }
+    producing.store(false, std::memory_order_release);
+    consumer.join();
+}
+
+bool TracePipeline::isRunning() const {
+    return consumer.joinable();
+}
+
+void TracePipeline::consume() {
+    StepRecord record;
+    for (;;) {
+        if (buffer.tryPop(record)) {
+            formatter(*output, record, compareExact);
+            // Pause for reading along, unless the solver is far ahead
+            if (delay > 0 && record.kind == StepRecord::Accepted && buffer.size() <= PACED_BACKLOG) {
+                output->flush();
+                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            }
+            continue;
+        }
+
+        // Everything pushed before finish() is visible once producing is false
+        if (!producing.load(std::memory_order_acquire)) {
+            if (buffer.empty()) {
+                break;
+            }
+            continue;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    output->flush();
+}
+
+namespace {
+
+// Exact solution and error lines shared by the fixed-step methods
+void writeExact(std::ostream& out, double exactValue, double y, bool compareExact) {
+    if (!compareExact) {
+        return;
+    }
+    double exact = std::round(exactValue * 10000.0) / 10000.0;
+    double error = std::abs(exact - y);
+    out << "Exact solution: " << exact << "\n";
+    out << "Error: " << std::fixed << std::setprecision(4) << error << "\n";
+}
+
+} // namespace
+
+void formatEulerStep(std::ostream& out, const StepRecord& record, bool compareExact) {
+    out << "\nStep " << record.step << ":" << "\n";
+    out << "x = " << std::fixed << std::setprecision(4) << record.x
+        << ", y = " << record.y << "\n";
+    writeExact(out, record.exact, record.y, compareExact);
+}
+
+void formatModifiedEulerStep(std::ostream& out, const StepRecord& record, bool compareExact) {
+    double yPredictor = record.yStart + record.h * record.k[0];
+    out << "\nStep " << record.step << ":" << "\n";
+    out << "x = " << std::fixed << std::setprecision(4) << record.x << "\n";
+    out << "Predictor (Euler): y* = " << roundForDisplay(yPredictor) << "\n";
+    out << "Corrector (Modified): y = " << record.y << "\n";
+    writeExact(out, record.exact, record.y, compareExact);
+}
+
+void formatRungeKutta2Step(std::ostream& out, const StepRecord& record, bool compareExact) {
+    out << "\nStep " << record.step << ":" << "\n";
+    out << "At x = " << std::fixed << std::setprecision(4) << record.xStart
+        << ", y = " << record.yStart << "\n";
+    out << "k1 = " << roundForDisplay(record.k[0]) << "\n";
+    out << "k2 = " << roundForDisplay(record.k[1]) << "\n";
+    out << "delta k = " << roundForDisplay(record.increment) << "\n";
+    out << "New y = " << record.y << " at x = " << std::fixed << std::setprecision(4) << record.x << "\n";
+    writeExact(out, record.exact, record.y, compareExact);
+}
+
+void formatRungeKutta4Step(std::ostream& out, const StepRecord& record, bool compareExact) {
+    out << "\nStep " << record.step << ":" << "\n";
+    out << "At x = " << std::fixed << std::setprecision(4) << record.xStart
+        << ", y = " << record.yStart << "\n";
+    out << "k1 = " << roundForDisplay(record.k[0]) << "\n";
+    out << "k2 = " << roundForDisplay(record.k[1]) << "\n";
+    out << "k3 = " << roundForDisplay(record.k[2]) << "\n";
+    out << "k4 = " << roundForDisplay(record.k[3]) << "\n";
+    out << "delta k = " << roundForDisplay(record.increment) << "\n";
+    out << "New y = " << record.y << " at x = " << std::fixed << std::setprecision(4) << record.x << "\n";
+    writeExact(out, record.exact, record.y, compareExact);
+}
+
+void formatAdamsBashforthStep(std::ostream& out, const StepRecord& record, bool compareExact) {
+    out << "\nStep " << record.step << ":" << "\n";
+    out << "New y = " << record.y << " at x = " << std::fixed << std::setprecision(4) << record.x << "\n";
+    writeExact(out, record.exact, record.y, compareExact);
+}
+
+void formatAdamsMoultonStep(std::ostream& out, const StepRecord& record, bool compareExact) {
+    out << "\nStep " << record.step << ":" << "\n";
+    out << "x = " << std::fixed << std::setprecision(4) << record.x << "\n";
+    out << "Predictor (Adams-Bashforth): y* = " << roundForDisplay(record.increment) << "\n";
+    out << "Corrector (Adams-Moulton): y = " << record.y << "\n";
+    writeExact(out, record.exact, record.y, compareExact);
+}
+
+void formatDormandPrinceStep(std::ostream& out, const StepRecord& record, bool compareExact) {
+    if (record.kind == StepRecord::Rejected) {
+        out << "\nStep rejected at x = " << std::fixed << std::setprecision(4) << record.xStart
+            << ", retrying with h = " << record.h << "\n";
+        return;
+    }
+
+    out << "\nStep " << record.step << ":" << "\n";
+    out << "h = " << std::fixed << std::setprecision(4) << record.h
+        << ", error estimate = " << std::scientific << std::setprecision(2)
+        << record.errorEstimate << "\n";
+    out << "New y = " << std::fixed << std::setprecision(4) << record.y << " at x = " << record.x << "\n";
+
+    if (compareExact) {
+        // Adaptive results are not rounded, so neither is the exact value
+        double exact = record.exact;
+        double error = std::abs(exact - record.y);
+        out << "Exact solution: " << exact << "\n";
+        out << "Error: " << std::scientific << std::setprecision(2) << error << "\n";
+    }
+}
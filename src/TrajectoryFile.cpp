@@ -0,0 +1,225 @@
+/**
+ * @file TrajectoryFile.cpp
+ * @brief Implementation of the binary trajectory format
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "TrajectoryFile.h"
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(TrajectoryHeader) == 256, "Trajectory header must stay 256 bytes");
+
+namespace {
+
+const char MAGIC[8] = { 'O', 'D', 'E', 'T', 'R', 'A', 'J', '\0' };
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+// Rows transposed per write when splitting system states into columns
+const size_t TRANSPOSE_BLOCK = 1 << 16;
+
+void copyName(char* dest, size_t destSize, const std::string& src) {
+    size_t n = std::min(src.size(), destSize - 1);
+    std::memcpy(dest, src.data(), n);
+    dest[n] = '\0';
+}
+
+void writeAll(std::FILE* file, const void* src, size_t bytes, const std::string& filename) {
+    if (bytes > 0 && std::fwrite(src, 1, bytes, file) != bytes) {
+        std::fclose(file);
+        throw std::runtime_error("Failed to write file: " + filename);
+    }
+}
+
+} // namespace
+
+void TrajectoryFile::write(const std::string& filename, const TrajectoryInfo& info,
+                           const double* x, const double* y, size_t count, size_t dimension) {
+    TrajectoryHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.headerSize = sizeof(TrajectoryHeader);
+    header.dimension = static_cast<uint32_t>(dimension);
+    header.pointCount = count;
+    header.stepCount = info.stepCount;
+    header.x0 = info.x0;
+    header.stepSize = info.stepSize;
+    header.xOffset = sizeof(TrajectoryHeader);
+    header.yOffset = header.xOffset + count * sizeof(double);
+    copyName(header.methodName, sizeof(header.methodName), info.methodName);
+    copyName(header.equationId, sizeof(header.equationId), info.equationId);
+
+    std::FILE* file = std::fopen(filename.c_str(), "wb");
+    if (file == NULL) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+
+    // Whole columns go straight to the OS, bypassing the stdio buffer
+    std::setvbuf(file, NULL, _IONBF, 0);
+
+    writeAll(file, &header, sizeof(header), filename);
+    writeAll(file, x, count * sizeof(double), filename);
+
+    if (dimension == 1) {
+        writeAll(file, y, count * sizeof(double), filename);
+    }
+    else {
+        // States are stored row by row; write them out column by column
+        std::vector<double> column(std::min(count, TRANSPOSE_BLOCK));
+        for (size_t j = 0; j < dimension; ++j) {
+            for (size_t begin = 0; begin < count; begin += column.size()) {
+                size_t rows = std::min(column.size(), count - begin);
+                for (size_t i = 0; i < rows; ++i) {
+                    column[i] = y[(begin + i) * dimension + j];
+                }
+                writeAll(file, column.data(), rows * sizeof(double), filename);
+            }
+        }
+    }
+
+    if (std::fclose(file) != 0) {
+        throw std::runtime_error("Failed to write file: " + filename);
+    }
+}
+
+TrajectoryFile::TrajectoryFile(const std::string& filename) : data(NULL), size(0), mapped(false) {
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Failed to read file: " + filename);
+    }
+    size = static_cast<size_t>(info.st_size);
+
+    if (size > 0) {
+        void* map = ::mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (map == MAP_FAILED) {
+            throw std::runtime_error("Failed to map file: " + filename);
+        }
+        data = static_cast<const char*>(map);
+        mapped = true;
+    }
+    else {
+        ::close(fd);
+    }
+#else
+    std::FILE* file = std::fopen(filename.c_str(), "rb");
+    if (file == NULL) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+    std::fseek(file, 0, SEEK_END);
+    fallback.resize(static_cast<size_t>(std::ftell(file)));
+    std::fseek(file, 0, SEEK_SET);
+    size_t read = fallback.empty() ? 0 : std::fread(&fallback[0], 1, fallback.size(), file);
+    std::fclose(file);
+    if (read != fallback.size()) {
+        throw std::runtime_error("Failed to read file: " + filename);
+    }
+    data = fallback.empty() ? NULL : &fallback[0];
+    size = fallback.size();
+#endif
+
+    // Validate the header before handing out any views
+    const char* problem = NULL;
+    if (size < sizeof(TrajectoryHeader)) {
+        problem = "file too small";
+    }
+    else {
+        const TrajectoryHeader& header = getHeader();
+        uint64_t columns = 1 + static_cast<uint64_t>(header.dimension);
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+            problem = "not a trajectory file";
+        }
+        else if (header.byteOrder != BYTE_ORDER_MARK) {
+            problem = "written with a different byte order";
+        }
+        else if (header.version != VERSION) {
+            problem = "unsupported version";
+        }
+        // Written so that no product or sum can wrap: the point count is
+        // bounded first, and each column is compared with what is left
+        // after its offset
+        else if (header.dimension == 0 ||
+                 header.pointCount > size / sizeof(double) / columns ||
+                 header.xOffset % sizeof(double) != 0 || header.yOffset % sizeof(double) != 0 ||
+                 header.xOffset > size ||
+                 header.pointCount > (size - header.xOffset) / sizeof(double) ||
+                 header.yOffset > size ||
+                 header.dimension * header.pointCount > (size - header.yOffset) / sizeof(double)) {
+            problem = "truncated or corrupt";
+        }
+    }
+
+    if (problem != NULL) {
+#ifndef _WIN32
+        if (mapped) {
+            ::munmap(const_cast<char*>(data), size);
+        }
+#endif
+        throw std::runtime_error("Invalid trajectory file " + filename + ": " + problem);
+    }
+}
+
+TrajectoryFile::~TrajectoryFile() {
+#ifndef _WIN32
+    if (mapped) {
+        ::munmap(const_cast<char*>(data), size);
+    }
+#endif
+}
+
+const TrajectoryHeader& TrajectoryFile::getHeader() const {
+    return *reinterpret_cast<const TrajectoryHeader*>(data);
+}
+
+std::string TrajectoryFile::getMethodName() const {
+    const TrajectoryHeader& header = getHeader();
+    return std::string(header.methodName, strnlen(header.methodName, sizeof(header.methodName)));
+}
+
+std::string TrajectoryFile::getEquationId() const {
+    const TrajectoryHeader& header = getHeader();
+    return std::string(header.equationId, strnlen(header.equationId, sizeof(header.equationId)));
+}
+
+size_t TrajectoryFile::getPointCount() const {
+    return static_cast<size_t>(getHeader().pointCount);
+}
+
+size_t TrajectoryFile::getDimension() const {
+    return getHeader().dimension;
+}
+
+ColumnView TrajectoryFile::getX() const {
+    const TrajectoryHeader& header = getHeader();
+    ColumnView view = { reinterpret_cast<const double*>(data + header.xOffset), getPointCount() };
+    return view;
+}
+
+ColumnView TrajectoryFile::getY(size_t component) const {
+    const TrajectoryHeader& header = getHeader();
+    if (component >= header.dimension) {
+        throw std::out_of_range("No such state component");
+    }
+    const char* column = data + header.yOffset + component * header.pointCount * sizeof(double);
+    ColumnView view = { reinterpret_cast<const double*>(column), getPointCount() };
+    return view;
+}
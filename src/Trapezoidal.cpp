@@ -0,0 +1,23 @@
+/**
+ * @file Trapezoidal.cpp
+ * @brief Implementation of the implicit trapezoidal rule
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "Trapezoidal.h"
+
+Trapezoidal::Trapezoidal(std::function<double(double, double)> diffFunc)
+    : ImplicitMethod(diffFunc) {}
+
+void Trapezoidal::integrate(double* y) {
+    integrateTheta(y, 0.5);
+}
+
+StepFormatter Trapezoidal::stepFormatter() const {
+    return formatEulerStep;
+}
+
+std::string Trapezoidal::getMethodName() const {
+    return "Trapezoidal Method";
+}
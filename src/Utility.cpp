@@ -6,26 +6,58 @@
  */
 
 #include "Utility.h"
+#include "Euler.h"
+#include "ModifiedEuler.h"
+#include "RungeKutta2.h"
+#include "RungeKutta4.h"
+#include "AdamsBashforth.h"
+#include "BackwardEuler.h"
+#include "Trapezoidal.h"
+#include "BDF.h"
+#include "SwitchingMethod.h"
+#include "TaylorMethod.h"
+#include "DormandPrince.h"
+#include "BulirschStoer.h"
+#include "ThreadPool.h"
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <cmath>
 #include <cstdlib>
+#include <chrono>
+#include <stdexcept>
 
 void Utility::compareAllMethods(const std::vector<NumericalMethod*>& methods) {
+    compareAllMethods(methods, std::vector<double>());
+}
+
+void Utility::compareAllMethods(const std::vector<NumericalMethod*>& methods,
+                                const std::vector<double>& wallTimes) {
+    bool showTimes = wallTimes.size() == methods.size();
+    bool showStats = SolveInstrumentation::enabled();
+    
     std::cout << "\n=== Comparison of All Methods ===" << std::endl;
     std::cout << std::fixed << std::setprecision(4);
     std::cout << std::left << std::setw(30) << "Method" 
              << std::setw(25) << "Result" 
              << std::setw(25) << "Exact Solution" 
-             << std::setw(25) << "Absolute Error" 
-             << std::endl;
-    std::cout << std::string(105, '-') << std::endl;
+             << std::setw(25) << "Absolute Error";
+    if (showTimes) {
+        std::cout << std::setw(15) << "Time (ms)";
+    }
+    if (showStats) {
+        std::cout << std::setw(12) << "RHS Calls"
+                  << std::setw(10) << "Steps";
+    }
+    std::cout << std::endl;
+    std::cout << std::string(105 + (showTimes ? 15 : 0) + (showStats ? 22 : 0), '-') << std::endl;
     
-    double exact = exactSolution(methods[0]->getXValues().back());
+    double exact = methods[0]->exactAt(methods[0]->getXValues().back());
     // Round to 4 decimal places
     exact = std::round(exact * 10000.0) / 10000.0;
     
-    for (const auto& method : methods) {
+    for (size_t i = 0; i < methods.size(); ++i) {
+        const NumericalMethod* method = methods[i];
         double result = method->getResult();
         // Round to 4 decimal places
         result = std::round(result * 10000.0) / 10000.0;
@@ -36,9 +68,177 @@ void Utility::compareAllMethods(const std::vector<NumericalMethod*>& methods) {
         std::cout << std::left << std::setw(30) << method->getMethodName()
                  << std::setw(25) << result
                  << std::setw(25) << exact
-                 << std::setw(25) << error
-                 << std::endl;
+                 << std::setw(25) << error;
+        if (showTimes) {
+            std::cout << std::setw(15) << wallTimes[i];
+        }
+        if (showStats) {
+            const SolveStats& stats = method->getSolveStats();
+            std::cout << std::setw(12) << stats.rhsCalls
+                      << std::setw(10) << stats.steps;
+        }
+        std::cout << std::endl;
+    }
+}
+
+std::vector<double> Utility::solveAll(const std::vector<NumericalMethod*>& methods, bool parallel) {
+    std::vector<double> wallTimes(methods.size(), 0.0);
+    
+    // Each task solves one method, or an RK4 method followed by the
+    // Adams-Bashforth methods that take their startup points from it, so no
+    // task waits for another
+    std::vector<std::vector<size_t> > tasks;
+    std::vector<size_t> adams;
+    size_t rk4Task = methods.size();
+    for (size_t i = 0; i < methods.size(); ++i) {
+        AdamsBashforth* method = dynamic_cast<AdamsBashforth*>(methods[i]);
+        if (method != NULL && method->getMode() != AdamsBashforth::Mode::Adaptive) {
+            adams.push_back(i);
+            continue;
+        }
+        if (rk4Task == methods.size() && dynamic_cast<RungeKutta4*>(methods[i]) != NULL) {
+            rk4Task = tasks.size();
+        }
+        tasks.push_back(std::vector<size_t>(1, i));
+    }
+    for (size_t j = 0; j < adams.size(); ++j) {
+        if (rk4Task < tasks.size()) {
+            tasks[rk4Task].push_back(adams[j]);
+        }
+        else {
+            tasks.push_back(std::vector<size_t>(1, adams[j]));
+        }
     }
+    
+    // Solve the methods of a task and store their wall times in milliseconds.
+    // Adams-Bashforth is charged the share of the RK4 time its startup used
+    auto solveTask = [&methods, &wallTimes](const std::vector<size_t>& task) {
+        const NumericalMethod* first = methods[task[0]];
+        for (size_t j = 0; j < task.size(); ++j) {
+            NumericalMethod* method = methods[task[j]];
+            AdamsBashforth* adams = (j > 0) ? static_cast<AdamsBashforth*>(method) : NULL;
+            if (adams != NULL) {
+                adams->setStartupValues(first->getXValues(), first->getYValues());
+            }
+            
+            auto start = std::chrono::steady_clock::now();
+            method->solve();
+            auto end = std::chrono::steady_clock::now();
+            wallTimes[task[j]] = std::chrono::duration<double, std::milli>(end - start).count();
+            
+            if (adams != NULL) {
+                adams->setStartupValues(std::vector<double>(), std::vector<double>());
+                size_t rk4Steps = first->getXValues().size() - 1;
+                if (rk4Steps > 0) {
+                    wallTimes[task[j]] += wallTimes[task[0]] * adams->getSharedStartupSteps() / rk4Steps;
+                }
+            }
+        }
+    };
+    
+    if (!parallel || tasks.size() < 2) {
+        for (size_t t = 0; t < tasks.size(); ++t) {
+            solveTask(tasks[t]);
+        }
+        return wallTimes;
+    }
+    
+    ThreadPool pool(static_cast<unsigned>(tasks.size()));
+    std::vector<std::future<void> > results;
+    for (size_t t = 0; t < tasks.size(); ++t) {
+        const std::vector<size_t>& task = tasks[t];
+        results.push_back(pool.submit([&solveTask, &task]() { solveTask(task); }));
+    }
+    
+    // get() rethrows the first exception thrown by a solve
+    for (size_t t = 0; t < results.size(); ++t) {
+        results[t].get();
+    }
+    return wallTimes;
+}
+
+NumericalMethod* Utility::createMethod(const std::string& name,
+                                       std::function<double(double, double)> diffFunc) {
+    if (name == "euler") {
+        return new EulersMethod(diffFunc);
+    }
+    if (name == "modified-euler" || name == "heun") {
+        return new ModifiedEulersMethod(diffFunc);
+    }
+    if (name == "rk2") {
+        return new RungeKutta2(diffFunc);
+    }
+    if (name == "rk4") {
+        return new RungeKutta4(diffFunc);
+    }
+    if (name == "adams-bashforth" || name == "ab") {
+        return new AdamsBashforth(diffFunc);
+    }
+    if (name == "adams-bashforth-moulton" || name == "abm") {
+        return new AdamsBashforth(diffFunc, 4, AdamsBashforth::Mode::PredictorCorrector);
+    }
+    if (name == "adaptive-adams") {
+        return new AdamsBashforth(diffFunc, AdamsBashforth::MAX_ORDER, AdamsBashforth::Mode::Adaptive);
+    }
+    // ab1 to ab5 and abm1 to abm5
+    bool corrected = name.compare(0, 3, "abm") == 0;
+    size_t digit = corrected ? 3 : 2;
+    if (name.compare(0, 2, "ab") == 0 && name.size() == digit + 1 && name[digit] >= '1' && name[digit] <= '5') {
+        return new AdamsBashforth(diffFunc, name[digit] - '0',
+                                  corrected ? AdamsBashforth::Mode::PredictorCorrector
+                                            : AdamsBashforth::Mode::Explicit);
+    }
+    if (name == "dormand-prince" || name == "dp") {
+        return new DormandPrince45(diffFunc);
+    }
+    if (name == "bulirsch-stoer" || name == "bs") {
+        return new BulirschStoer(diffFunc);
+    }
+    if (name == "backward-euler") {
+        return new BackwardEuler(diffFunc);
+    }
+    if (name == "trapezoidal") {
+        return new Trapezoidal(diffFunc);
+    }
+    if (name == "bdf") {
+        return new BDF(diffFunc);
+    }
+    // bdf1 to bdf5 limit the highest order
+    if (name.size() == 4 && name.compare(0, 3, "bdf") == 0 && name[3] >= '1' && name[3] <= '5') {
+        return new BDF(diffFunc, name[3] - '0');
+    }
+    if (name == "switching") {
+        return new SwitchingMethod(diffFunc);
+    }
+    if (name == "taylor") {
+        // Needs the equation as a template, which only the default one has here
+        typedef double (*Equation)(double, double);
+        const Equation* equation = diffFunc.target<Equation>();
+        if (equation == NULL || *equation != differentialFunction) {
+            throw std::invalid_argument("The Taylor method needs a templated right-hand side, see TaylorMethod");
+        }
+        return new TaylorMethod();
+    }
+    throw std::invalid_argument("Unknown method: " + name);
+}
+
+std::vector<std::string> Utility::getMethodNames() {
+    std::vector<std::string> names;
+    names.push_back("euler");
+    names.push_back("modified-euler");
+    names.push_back("rk2");
+    names.push_back("rk4");
+    names.push_back("adams-bashforth");
+    names.push_back("adams-bashforth-moulton");
+    names.push_back("adaptive-adams");
+    names.push_back("dormand-prince");
+    names.push_back("bulirsch-stoer");
+    names.push_back("backward-euler");
+    names.push_back("trapezoidal");
+    names.push_back("bdf");
+    names.push_back("switching");
+    names.push_back("taylor");
+    return names;
 }
 
 void Utility::clearScreen() {
@@ -0,0 +1,288 @@
+/**
+ * @file WorkPrecision.cpp
+ * @brief Implementation of the work-precision measurements
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "WorkPrecision.h"
+#include "Euler.h"
+#include "ModifiedEuler.h"
+#include "RungeKutta2.h"
+#include "RungeKutta4.h"
+#include "AdamsBashforth.h"
+#include "DormandPrince.h"
+#include "BulirschStoer.h"
+#include "BackwardEuler.h"
+#include "Trapezoidal.h"
+#include "BDF.h"
+#include "SwitchingMethod.h"
+#include "PrecisionPolicy.h"
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// Tolerance of adaptive methods at level 0
+const double BASE_TOLERANCE = 1e-3;
+
+// Print a number for JSON, which has no NaN or infinity
+void printJsonNumber(std::FILE* file, double value) {
+    if (std::isfinite(value)) {
+        std::fprintf(file, "%.17g", value);
+    }
+    else {
+        std::fprintf(file, "null");
+    }
+}
+
+// Set both tolerances of an adaptive method; false for fixed-step methods
+bool setAdaptiveTolerance(NumericalMethod* method, double tolerance) {
+    DormandPrince45* dormandPrince = dynamic_cast<DormandPrince45*>(method);
+    if (dormandPrince != NULL) {
+        dormandPrince->setTolerances(tolerance, tolerance);
+        return true;
+    }
+    BulirschStoer* bulirschStoer = dynamic_cast<BulirschStoer*>(method);
+    if (bulirschStoer != NULL) {
+        bulirschStoer->setTolerances(tolerance, tolerance);
+        return true;
+    }
+    AdamsBashforth* adams = dynamic_cast<AdamsBashforth*>(method);
+    if (adams != NULL && adams->getMode() == AdamsBashforth::Mode::Adaptive) {
+        adams->setTolerances(tolerance, tolerance);
+        return true;
+    }
+    BDF* bdf = dynamic_cast<BDF*>(method);
+    if (bdf != NULL) {
+        bdf->setTolerances(tolerance, tolerance);
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+WorkPrecision::WorkPrecision()
+    : largestStep(0.1), levels(8), xTarget(1.0), repeats(3) {
+}
+
+void WorkPrecision::addMethod(MethodFactory factory) {
+    factories.push_back(factory);
+}
+
+void WorkPrecision::addAllMethods() {
+    typedef std::function<double(double, double)> Function;
+    addMethod([](Function f) -> NumericalMethod* { return new EulersMethod(f); });
+    addMethod([](Function f) -> NumericalMethod* { return new ModifiedEulersMethod(f); });
+    addMethod([](Function f) -> NumericalMethod* { return new RungeKutta2(f); });
+    addMethod([](Function f) -> NumericalMethod* { return new RungeKutta4(f); });
+    addMethod([](Function f) -> NumericalMethod* { return new AdamsBashforth(f); });
+    addMethod([](Function f) -> NumericalMethod* {
+        return new AdamsBashforth(f, 4, AdamsBashforth::Mode::PredictorCorrector);
+    });
+    addMethod([](Function f) -> NumericalMethod* {
+        return new AdamsBashforth(f, AdamsBashforth::MAX_ORDER, AdamsBashforth::Mode::Adaptive);
+    });
+    addMethod([](Function f) -> NumericalMethod* { return new DormandPrince45(f); });
+    addMethod([](Function f) -> NumericalMethod* { return new BulirschStoer(f); });
+    addMethod([](Function f) -> NumericalMethod* { return new BackwardEuler(f); });
+    addMethod([](Function f) -> NumericalMethod* { return new Trapezoidal(f); });
+    addMethod([](Function f) -> NumericalMethod* { return new BDF(f); });
+    addMethod([](Function f) -> NumericalMethod* { return new SwitchingMethod(f); });
+}
+
+void WorkPrecision::setStepSizes(double h0, int levelCount) {
+    if (!(h0 > 0.0) || levelCount < 1) {
+        throw std::invalid_argument("Step size must be positive and there must be at least one level");
+    }
+    largestStep = h0;
+    levels = levelCount;
+}
+
+void WorkPrecision::setTarget(double xTargetVal) {
+    xTarget = xTargetVal;
+}
+
+void WorkPrecision::setRepeats(int count) {
+    repeats = (count < 1) ? 1 : count;
+}
+
+const std::vector<WorkPrecisionPoint>& WorkPrecision::run() {
+    points.clear();
+
+    for (size_t m = 0; m < factories.size(); ++m) {
+        for (int level = 0; level < levels; ++level) {
+            WorkPrecisionPoint point;
+            point.level = level;
+            point.stepSize = largestStep / std::pow(2.0, level);
+            point.tolerance = 0.0;
+            point.seconds = std::numeric_limits<double>::infinity();
+            point.observedOrder = std::numeric_limits<double>::quiet_NaN();
+
+            // Each repeat gets a fresh method, so no run sees stored results
+            long counter = 0;
+            for (int r = 0; r < repeats; ++r) {
+                counter = 0;
+                std::unique_ptr<NumericalMethod> method(factories[m]([&counter](double x, double y) {
+                    ++counter;
+                    return differentialFunction(x, y);
+                }));
+                method->setVerbose(false);
+                method->setParameters(0.0, 1.0, xTarget, point.stepSize);
+
+                // Adaptive methods get tighter tolerances instead of smaller steps
+                double tolerance = BASE_TOLERANCE * std::pow(2.0, -5.0 * level);
+                if (setAdaptiveTolerance(method.get(), tolerance)) {
+                    point.stepSize = largestStep;
+                    point.tolerance = tolerance;
+                    method->setParameters(0.0, 1.0, xTarget, point.stepSize);
+                }
+
+                auto start = std::chrono::steady_clock::now();
+                method->solve();
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+                point.seconds = std::min(point.seconds, seconds);
+                point.method = method->getMethodName();
+                point.error = method->calculateError();
+            }
+            point.evaluations = counter;
+
+            // Order in h from the errors at h and h/2; tolerance-driven runs have none
+            if (level > 0 && point.tolerance == 0.0) {
+                const WorkPrecisionPoint& previous = points.back();
+                if (point.error > 0.0 && previous.error > 0.0) {
+                    point.observedOrder = std::log2(previous.error / point.error);
+                }
+            }
+            points.push_back(point);
+        }
+    }
+
+    return points;
+}
+
+const std::vector<WorkPrecisionPoint>& WorkPrecision::getPoints() const {
+    return points;
+}
+
+const WorkPrecisionPoint* WorkPrecision::cheapest(double targetError, bool byEvaluations) const {
+    const WorkPrecisionPoint* best = NULL;
+    for (size_t i = 0; i < points.size(); ++i) {
+        const WorkPrecisionPoint& point = points[i];
+        if (!(point.error <= targetError)) {
+            continue;
+        }
+        double cost = byEvaluations ? static_cast<double>(point.evaluations) : point.seconds;
+        double bestCost = (best == NULL) ? 0.0 :
+            (byEvaluations ? static_cast<double>(best->evaluations) : best->seconds);
+        if (best == NULL || cost < bestCost) {
+            best = &point;
+        }
+    }
+    return best;
+}
+
+void WorkPrecision::printTable() const {
+    // Widen the method column for long method names
+    size_t methodWidth = 30;
+    for (size_t i = 0; i < points.size(); ++i) {
+        methodWidth = std::max(methodWidth, points[i].method.size() + 2);
+    }
+
+    std::cout << "Precision: " << PrecisionPolicy::name() << std::endl << std::endl;
+    std::cout << std::left << std::setw(methodWidth) << "Method"
+              << std::setw(14) << "h"
+              << std::setw(12) << "Tolerance"
+              << std::setw(14) << "Evaluations"
+              << std::setw(14) << "Time (s)"
+              << std::setw(14) << "Error"
+              << std::setw(8) << "Order" << std::endl;
+    std::cout << std::string(76 + methodWidth, '-') << std::endl;
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        const WorkPrecisionPoint& point = points[i];
+        std::cout << std::left << std::setw(methodWidth) << point.method
+                  << std::setw(14) << std::scientific << std::setprecision(3) << point.stepSize
+                  << std::setw(12) << std::setprecision(1) << point.tolerance
+                  << std::setw(14) << point.evaluations
+                  << std::setw(14) << std::setprecision(3) << point.seconds
+                  << std::setw(14) << point.error;
+        if (std::isfinite(point.observedOrder)) {
+            std::cout << std::fixed << std::setprecision(2) << point.observedOrder;
+        }
+        else {
+            std::cout << "-";
+        }
+        std::cout << std::endl;
+    }
+    std::cout.unsetf(std::ios::floatfield);
+}
+
+void WorkPrecision::saveToCSV(const std::string& filename) const {
+    std::FILE* file = std::fopen(filename.c_str(), "w");
+    if (file == NULL) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+
+    std::fprintf(file, "method,level,stepSize,tolerance,evaluations,seconds,error,observedOrder\n");
+    for (size_t i = 0; i < points.size(); ++i) {
+        const WorkPrecisionPoint& point = points[i];
+        std::fprintf(file, "\"%s\",%d,%.17g,%.17g,%ld,%.17g,%.17g,",
+                     point.method.c_str(), point.level, point.stepSize, point.tolerance,
+                     point.evaluations, point.seconds, point.error);
+        // No order is left empty
+        if (std::isfinite(point.observedOrder)) {
+            std::fprintf(file, "%.17g", point.observedOrder);
+        }
+        std::fprintf(file, "\n");
+    }
+
+    if (std::fclose(file) != 0) {
+        throw std::runtime_error("Failed to write file: " + filename);
+    }
+}
+
+void WorkPrecision::saveToJSON(const std::string& filename) const {
+    bool toStdout = (filename == "-");
+    std::FILE* file = toStdout ? stdout : std::fopen(filename.c_str(), "w");
+    if (file == NULL) {
+        throw std::runtime_error("Failed to open file: " + filename);
+    }
+
+    std::fprintf(file, "{\n  \"precision\": \"%s\",\n", PrecisionPolicy::name());
+    std::fprintf(file, "  \"problem\": {\"x0\": 0, \"y0\": 1, \"xTarget\": ");
+    printJsonNumber(file, xTarget);
+    std::fprintf(file, "},\n  \"points\": [\n");
+    for (size_t i = 0; i < points.size(); ++i) {
+        const WorkPrecisionPoint& point = points[i];
+        std::fprintf(file, "    {\"method\": \"%s\", \"level\": %d, \"stepSize\": ",
+                     point.method.c_str(), point.level);
+        printJsonNumber(file, point.stepSize);
+        std::fprintf(file, ", \"tolerance\": ");
+        printJsonNumber(file, point.tolerance);
+        std::fprintf(file, ", \"evaluations\": %ld, \"seconds\": ", point.evaluations);
+        printJsonNumber(file, point.seconds);
+        std::fprintf(file, ", \"error\": ");
+        printJsonNumber(file, point.error);
+        std::fprintf(file, ", \"observedOrder\": ");
+        printJsonNumber(file, point.observedOrder);
+        std::fprintf(file, "}%s\n", (i + 1 < points.size()) ? "," : "");
+    }
+    std::fprintf(file, "  ]\n}\n");
+
+    if (toStdout) {
+        std::fflush(file);
+    }
+    else if (std::fclose(file) != 0) {
+        throw std::runtime_error("Failed to write file: " + filename);
+    }
+}
@@ -0,0 +1,52 @@
+/**
+ * @file Workspace.cpp
+ * @brief Implementation of the solve workspace
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ */
+
+#include "Workspace.h"
+#include <algorithm>
+
+Workspace::Workspace() : current(0), used(0) {
+}
+
+double* Workspace::allocate(size_t count) {
+    count = (count + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+    // Move on to the next block that is large enough, or add one
+    while (current < blocks.size() && used + count > blockSizes[current]) {
+        ++current;
+        used = 0;
+    }
+    if (current == blocks.size()) {
+        size_t size = std::max(count, capacity());
+        blocks.push_back(std::unique_ptr<double[]>(new double[size]));
+        blockSizes.push_back(size);
+        used = 0;
+    }
+
+    double* buffer = blocks[current].get() + used;
+    used += count;
+    return buffer;
+}
+
+void Workspace::clear() {
+    if (blocks.size() > 1) {
+        size_t size = capacity();
+        blocks.clear();
+        blockSizes.clear();
+        blocks.push_back(std::unique_ptr<double[]>(new double[size]));
+        blockSizes.push_back(size);
+    }
+    current = 0;
+    used = 0;
+}
+
+size_t Workspace::capacity() const {
+    size_t total = 0;
+    for (size_t i = 0; i < blockSizes.size(); ++i) {
+        total += blockSizes[i];
+    }
+    return total;
+}
@@ -3,6 +3,19 @@
  * @brief Main program for numerical differential equation solver
  * @author Prathamesh Khade
  * @date 2025-06-07
+ *
+ * Without arguments the solver runs interactively. With arguments it runs
+ * headless batch jobs:
+ *
+ *   solver --jobs FILE [--threads N] [--summary FILE]
+ *   solver --method NAME [--equation EXPR | --plugin LIB] [--solution EXPR]
+ *          [--x0 X] [--y0 Y] [--x-target X] [--h H] [--exact] [--csv FILE]
+ *          [--binary FILE] [--summary FILE]
+ *
+ * EXPR is an Expression in x and y, such as "x + y" or "-50*(y - cos(x))".
+ * LIB is a shared library implementing OdePlugin.h.
+ *
+ * See BatchRunner::loadJobFile for the job file format.
  */
 
 #include <iostream>
@@ -12,6 +25,7 @@
 #include <limits>
 #include <chrono>
 #include <thread>
+#include <cstdlib>
 
 #include "NumericalMethod.h"
 #include "Euler.h"
@@ -19,13 +33,134 @@
 #include "RungeKutta2.h"
 #include "RungeKutta4.h"
 #include "AdamsBashforth.h"
+#include "DormandPrince.h"
 #include "Utility.h"
+#include "BatchRunner.h"
+
+namespace {
+
+void printUsage() {
+    std::cerr << "Usage: solver\n"
+              << "       solver --jobs FILE [--threads N] [--summary FILE]\n"
+              << "       solver --method NAME [--equation EXPR | --plugin LIB] [--solution EXPR]\n"
+              << "              [--x0 X] [--y0 Y] [--x-target X] [--h H] [--exact] [--csv FILE]\n"
+              << "              [--binary FILE] [--summary FILE]\n"
+              << "Methods:";
+    std::vector<std::string> names = Utility::getMethodNames();
+    for (size_t i = 0; i < names.size(); ++i) {
+        std::cerr << " " << names[i];
+    }
+    std::cerr << std::endl;
+}
+
+/**
+ * @brief Run the jobs given on the command line, without any prompts
+ * @return 0 if every job succeeded, 1 if a job failed, 2 for bad arguments
+ */
+int runBatch(int argc, char* argv[]) {
+    std::string jobFile;
+    std::string summaryFile;
+    unsigned threads = 0;
+    BatchJob job;
+    bool haveJob = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--exact") {
+            job.compareExact = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            printUsage();
+            return 2;
+        }
+        const char* value = argv[++i];
+        if (arg == "--jobs") {
+            jobFile = value;
+        }
+        else if (arg == "--threads") {
+            threads = static_cast<unsigned>(std::atoi(value));
+        }
+        else if (arg == "--summary") {
+            summaryFile = value;
+        }
+        else if (arg == "--method") {
+            job.method = value;
+            haveJob = true;
+        }
+        else if (arg == "--equation") {
+            job.equation = value;
+        }
+        else if (arg == "--solution") {
+            job.solution = value;
+        }
+        else if (arg == "--plugin") {
+            job.plugin = value;
+        }
+        else if (arg == "--x0") {
+            job.x0 = std::atof(value);
+        }
+        else if (arg == "--y0") {
+            job.y0 = std::atof(value);
+        }
+        else if (arg == "--x-target") {
+            job.xTarget = std::atof(value);
+        }
+        else if (arg == "--h") {
+            job.stepSize = std::atof(value);
+        }
+        else if (arg == "--csv") {
+            job.csvFile = value;
+        }
+        else if (arg == "--binary") {
+            job.binaryFile = value;
+        }
+        else {
+            printUsage();
+            return 2;
+        }
+    }
+
+    if (jobFile.empty() == !haveJob) {
+        printUsage();
+        return 2;
+    }
+
+    try {
+        BatchRunner runner(threads);
+        if (haveJob) {
+            runner.addJob(job);
+        }
+        else {
+            runner.loadJobFile(jobFile);
+        }
+        runner.run();
+
+        runner.printSummary(std::cout);
+        if (!summaryFile.empty()) {
+            runner.saveToCSV(summaryFile);
+        }
+        return runner.getFailureCount() == 0 ? 0 : 1;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 2;
+    }
+}
+
+} // namespace
 
 /**
  * @brief Main function
+ * @param argc Number of arguments
+ * @param argv Arguments; any argument selects batch mode
  * @return 0 on successful execution
  */
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        return runBatch(argc, argv);
+    }
+    
     // Welcome message
     Utility::clearScreen();
     std::cout << "===============================================" << std::endl;
@@ -78,7 +213,8 @@ int main() {
     std::cout << "4. 4th Order Runge-Kutta Method" << std::endl;
     std::cout << "5. Adams-Bashforth Method" << std::endl;
     std::cout << "6. All Methods (for comparison)" << std::endl;
-    std::cout << "Enter your choice (1-6): ";
+    std::cout << "7. Dormand-Prince 5(4) Method (adaptive step size)" << std::endl;
+    std::cout << "Enter your choice (1-7): ";
     std::cin >> option;
     
     // Vector to store all methods if comparison is requested
@@ -174,26 +310,51 @@ int main() {
                 methods.push_back(new RungeKutta2());
                 methods.push_back(new RungeKutta4());
                 methods.push_back(new AdamsBashforth());
+                methods.push_back(new DormandPrince45());
                 
-                // Set parameters and solve
+                // Set parameters
                 for (auto& method : methods) {
                     method->setParameters(x0, y0, xTarget, stepSize);
                     method->setCompareExact(compareWithExact);
                     method->setVerbose(false);
-                    method->solve();
-                    
-                    if (saveResults) {
+                }
+                
+                // Solve all methods concurrently
+                std::vector<double> wallTimes = Utility::solveAll(methods);
+                
+                if (saveResults) {
+                    for (auto& method : methods) {
                         method->saveToCSV(method->getMethodName() + "_results.csv");
                     }
                 }
                 
                 // Compare all methods
-                Utility::compareAllMethods(methods);
+                Utility::compareAllMethods(methods, wallTimes);
+                break;
+            }
+            
+            case 7: {
+                DormandPrince45 dormandPrince;
+                dormandPrince.setParameters(x0, y0, xTarget, stepSize);
+                dormandPrince.setCompareExact(compareWithExact);
+                dormandPrince.solve();
+                
+                if (compareWithExact) {
+                    dormandPrince.reportSavings();
+                }
+                
+                if (saveResults) {
+                    dormandPrince.saveToCSV("dormand_prince_results.csv");
+                }
+                
+                if (runComparison) {
+                    methods.push_back(new DormandPrince45());
+                }
                 break;
             }
             
             default: {
-                std::cout << "\nInvalid option! Please choose a number between 1 and 6." << std::endl;
+                std::cout << "\nInvalid option! Please choose a number between 1 and 7." << std::endl;
                 break;
             }
         }
@@ -205,11 +366,11 @@ int main() {
                 method->setParameters(x0, y0, xTarget, stepSize);
                 method->setCompareExact(compareWithExact);
                 method->setVerbose(false);
-                method->solve();
             }
+            std::vector<double> wallTimes = Utility::solveAll(methods);
             
             // Compare results
-            Utility::compareAllMethods(methods);
+            Utility::compareAllMethods(methods, wallTimes);
         }
         
         // Clean up
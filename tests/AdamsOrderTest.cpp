@@ -0,0 +1,74 @@
+/**
+ * @file AdamsOrderTest.cpp
+ * @brief Checks the observed order of the fixed-step Adams methods
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Solves dy/dx = x + y, y(0) = 1, on [0, 1] with Adams-Bashforth and
+ * Adams-Bashforth-Moulton of orders 1 to 5 with h = 0.02, 0.01 and 0.005,
+ * and computes the observed order log2(e(2h) / e(h)) from the errors at
+ * x = 1; smaller steps of order 5 reach rounding error.
+ * solveSystem() keeps full precision, so rounding to 4 decimal places does
+ * not hide the truncation error. Exits with 1 if a check fails.
+ */
+
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "AdamsBashforth.h"
+
+namespace {
+
+const double FIRST_STEP = 0.02;
+const int HALVINGS = 2;
+const double ORDER_TOLERANCE = 0.2;
+
+int failures = 0;
+
+void check(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+double errorAt(AdamsBashforth& method, double h) {
+    method.setParameters(0.0, std::vector<double>(1, exactSolution(0.0)), 1.0, h);
+    method.solveSystem();
+    return std::abs(method.getStateResult()[0] - exactSolution(1.0));
+}
+
+void testOrder(int order, AdamsBashforth::Mode mode) {
+    AdamsBashforth method(differentialFunction, order, mode);
+    method.setVerbose(false);
+    method.setSystemFunction([](double x, const double* y, double* dydx) { dydx[0] = x + y[0]; });
+
+    double h = FIRST_STEP;
+    double previous = errorAt(method, h);
+    for (int i = 0; i < HALVINGS; ++i) {
+        h /= 2.0;
+        double error = errorAt(method, h);
+        double observed = std::log2(previous / error);
+        check(std::abs(observed - order) <= ORDER_TOLERANCE,
+              method.getMethodName() + ", h = " + std::to_string(h) + ": observed order " + std::to_string(observed));
+        previous = error;
+    }
+}
+
+} // namespace
+
+int main() {
+    for (int order = 1; order <= 5; ++order) {
+        testOrder(order, AdamsBashforth::Mode::Explicit);
+        testOrder(order, AdamsBashforth::Mode::PredictorCorrector);
+    }
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All Adams order checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file DenseOutputTest.cpp
+ * @brief Checks evaluateAt on forward and backward solves
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Solves the default equation dy/dx = x + y on [0, 1] forward from y(0)
+ * and backward from y(1), then compares evaluateAt between the steps with
+ * exactSolution. Exits with 1 if a check fails.
+ */
+
+#include <iostream>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "RungeKutta4.h"
+#include "DormandPrince.h"
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+// Largest error of evaluateAt at points between the steps, single and batched
+double maxError(const NumericalMethod& method) {
+    std::vector<double> xs;
+    for (int i = 0; i <= 40; ++i) {
+        xs.push_back(0.0123 + i * 0.0243);
+    }
+    std::vector<double> ys = method.evaluateAt(xs);
+
+    double error = 0.0;
+    for (size_t i = 0; i < xs.size(); ++i) {
+        error = std::max(error, std::abs(ys[i] - exactSolution(xs[i])));
+        error = std::max(error, std::abs(method.evaluateAt(xs[i]) - exactSolution(xs[i])));
+    }
+
+    // Queries against the direction of the batch, answered by binary search
+    for (size_t i = xs.size(); i-- > 0;) {
+        error = std::max(error, std::abs(method.evaluateAt(xs[i]) - exactSolution(xs[i])));
+    }
+    return error;
+}
+
+bool throwsOutOfRange(const NumericalMethod& method, double x) {
+    try {
+        method.evaluateAt(x);
+    }
+    catch (const std::out_of_range&) {
+        return true;
+    }
+    return false;
+}
+
+void testMethod(NumericalMethod& method, double h, double tolerance, bool dense) {
+    const std::string name = method.getMethodName();
+    method.setVerbose(false);
+    method.setDenseOutput(dense);
+    const std::string mode = dense ? " (dense)" : " (Hermite)";
+
+    method.setParameters(0.0, exactSolution(0.0), 1.0, h);
+    method.solve();
+    check(maxError(method) <= tolerance, name + mode + ", forward");
+
+    method.setParameters(1.0, exactSolution(1.0), 0.0, -h);
+    method.solve();
+    check(maxError(method) <= tolerance, name + mode + ", backward");
+    check(std::abs(method.evaluateAt(0.0) - method.getResult()) <= tolerance, name + mode + ", backward end point");
+    check(throwsOutOfRange(method, -0.1) && throwsOutOfRange(method, 1.1), name + mode + ", backward range");
+}
+
+} // namespace
+
+int main() {
+    // RK4 rounds to 4 decimal places unless built with full precision
+    RungeKutta4 rk4;
+    testMethod(rk4, 0.1, 1e-3, false);
+    testMethod(rk4, 0.1, 1e-3, true);
+
+    DormandPrince45 dormandPrince;
+    dormandPrince.setTolerances(1e-9, 1e-9);
+    testMethod(dormandPrince, 0.1, 1e-6, false);
+    testMethod(dormandPrince, 0.1, 1e-7, true);
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All dense output checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file EnsembleTest.cpp
+ * @brief Checks the ensemble solver against the single-member methods
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Every scheme is run with every kernel set this CPU supports on members
+ * of dy/dx = x + y with different x0 and y0, including a member count that
+ * is not a multiple of the vector width or the block size. Each member
+ * must match solveSystem() of the matching method, which like the
+ * ensemble keeps full precision. Exits with 1 if a check fails.
+ */
+
+#include <iostream>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Ensemble.h"
+#include "Euler.h"
+#include "ModifiedEuler.h"
+#include "RungeKutta2.h"
+#include "RungeKutta4.h"
+
+namespace {
+
+const double INTERVAL = 1.0;
+const double STEP = 0.01;
+const double TOLERANCE = 1e-11;
+
+int failures = 0;
+
+void check(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+NumericalMethod* createReference(EnsembleSolver::Scheme scheme) {
+    switch (scheme) {
+        case EnsembleSolver::Scheme::Euler:
+            return new EulersMethod();
+        case EnsembleSolver::Scheme::ModifiedEuler:
+            return new ModifiedEulersMethod();
+        case EnsembleSolver::Scheme::RungeKutta2:
+            return new RungeKutta2();
+        case EnsembleSolver::Scheme::RungeKutta4:
+            return new RungeKutta4();
+    }
+    return NULL;
+}
+
+void testScheme(EnsembleSolver::Scheme scheme, size_t members) {
+    std::vector<double> x0s(members), y0s(members);
+    for (size_t i = 0; i < members; ++i) {
+        x0s[i] = -0.5 + 0.001 * i;
+        y0s[i] = 1.0 - 0.002 * i;
+    }
+
+    // Final y of every member, one solve at a time
+    std::unique_ptr<NumericalMethod> reference(createReference(scheme));
+    reference->setVerbose(false);
+    reference->setSystemFunction([](double x, const double* y, double* dydx) { dydx[0] = x + y[0]; });
+    std::vector<double> expected(members);
+    std::vector<double> y0(1);
+    for (size_t i = 0; i < members; ++i) {
+        y0[0] = y0s[i];
+        reference->setParameters(x0s[i], y0, x0s[i] + INTERVAL, STEP);
+        reference->solveSystem();
+        expected[i] = reference->getStateResult()[0];
+    }
+
+    EnsembleSolver ensemble(scheme);
+    std::vector<std::string> kernels = EnsembleSolver::getAvailableKernels();
+    for (size_t k = 0; k < kernels.size(); ++k) {
+        ensemble.setKernel(kernels[k]);
+        ensemble.setParameters(x0s, y0s, INTERVAL, STEP);
+        ensemble.solve();
+
+        double error = 0.0;
+        double xError = 0.0;
+        for (size_t i = 0; i < members; ++i) {
+            error = std::max(error, std::abs(ensemble.getYValues()[i] - expected[i]));
+            xError = std::max(xError, std::abs(ensemble.getXValues()[i] - (x0s[i] + INTERVAL)));
+        }
+        std::string what = ensemble.getMethodName() + ", " + kernels[k] + ", " + std::to_string(members) + " members";
+        check(error <= TOLERANCE, what + ": y differs by " + std::to_string(error));
+        check(xError <= 1e-12, what + ": final x");
+    }
+}
+
+} // namespace
+
+int main() {
+    const EnsembleSolver::Scheme schemes[] = {
+        EnsembleSolver::Scheme::Euler,
+        EnsembleSolver::Scheme::ModifiedEuler,
+        EnsembleSolver::Scheme::RungeKutta2,
+        EnsembleSolver::Scheme::RungeKutta4
+    };
+    for (size_t s = 0; s < sizeof(schemes) / sizeof(schemes[0]); ++s) {
+        testScheme(schemes[s], 1);
+        testScheme(schemes[s], 1027);
+    }
+
+    // Kernel selection
+    EnsembleSolver ensemble;
+    check(std::string(ensemble.getKernel()) == EnsembleSolver::getKernelName(), "default kernel");
+    ensemble.setKernel("scalar");
+    check(std::string(ensemble.getKernel()) == "scalar", "forced scalar kernel");
+    ensemble.setKernel("auto");
+    check(std::string(ensemble.getKernel()) == EnsembleSolver::getKernelName(), "auto kernel");
+    bool threw = false;
+    try {
+        ensemble.setKernel("sse9");
+    }
+    catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check(threw, "unknown kernel");
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All ensemble checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file ExpressionTest.cpp
+ * @brief Checks Expression against the same functions written in C++
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Evaluates a table of expressions, one point at a time and in batches,
+ * at points that include zeros of both signs and compares them with
+ * hand-written C++. Also checks precedence, shared subexpressions, that
+ * the simplifications keep signed zeros and single roundings, and the
+ * messages of parse errors. Exits with 1 if a check fails.
+ */
+
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Expression.h"
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+struct Case {
+    const char* text;
+    std::function<double(double, double)> reference;
+};
+
+// Same double, or both NaN; a few ulps are allowed where C++ may contract to FMA
+bool close(double value, double expected) {
+    if (std::isnan(expected)) {
+        return std::isnan(value);
+    }
+    if (value == expected) {
+        return true;
+    }
+    return std::abs(value - expected) <= 1e-14 * std::max(1.0, std::abs(expected));
+}
+
+bool identical(double a, double b) {
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+std::string errorOf(const std::string& text) {
+    try {
+        Expression expression(text);
+    }
+    catch (const std::invalid_argument& e) {
+        return e.what();
+    }
+    return "";
+}
+
+void testTable() {
+    const Case cases[] = {
+        { "x + y", [](double x, double y) { return x + y; } },
+        { "x*y - sin(x)", [](double x, double y) { return x * y - std::sin(x); } },
+        { "-50*(y - cos(x))", [](double x, double y) { return -50 * (y - std::cos(x)); } },
+        { "-x^2", [](double x, double) { return -(x * x); } },
+        { "2^3^2", [](double, double) { return 512.0; } },
+        { "(2^3)^2", [](double, double) { return 64.0; } },
+        { "x^3 - 2*x^4", [](double x, double) { return std::pow(x, 3.0) - 2 * std::pow(x, 4.0); } },
+        { "x - y - 1", [](double x, double y) { return (x - y) - 1; } },
+        { "x / y / 2", [](double x, double y) { return (x / y) / 2; } },
+        { "1 + 2*x - -y", [](double x, double y) { return 1 + 2 * x + y; } },
+        { "x/3 + y/0.5", [](double x, double y) { return x / 3 + y / 0.5; } },
+        { "exp(-x) * sqrt(abs(y))", [](double x, double y) { return std::exp(-x) * std::sqrt(std::abs(y)); } },
+        { "log(abs(x) + 1) + ln(2) + log10(100)",
+          [](double x, double) { return std::log(std::abs(x) + 1) + std::log(2.0) + std::log10(100.0); } },
+        { "atan2(y, x) + pow(abs(x), 1.5) + min(x, y) * max(x, y)",
+          [](double x, double y) { return std::atan2(y, x) + std::pow(std::abs(x), 1.5) + std::min(x, y) * std::max(x, y); } },
+        { "tanh(x) + sinh(y) - cosh(x*y)",
+          [](double x, double y) { return std::tanh(x) + std::sinh(y) - std::cosh(x * y); } },
+        { "pi * e", [](double, double) { return M_PI * M_E; } },
+        { "1.5e-3 * x + .25", [](double x, double) { return 1.5e-3 * x + 0.25; } },
+        { "sin(x)^2 + cos(x)^2 + sin(x)", [](double x, double) {
+              return std::sin(x) * std::sin(x) + std::cos(x) * std::cos(x) + std::sin(x); } },
+        { "x + 0", [](double x, double) { return x + 0.0; } },
+        { "0 - x", [](double x, double) { return 0.0 - x; } },
+        { "x * 1 - 0", [](double x, double) { return x; } },
+        { "x^-1", [](double x, double) { return 1 / x; } },
+        { "x / 0", [](double x, double) { return x / 0.0; } }
+    };
+
+    const double points[][2] = {
+        { 0.0, 0.0 }, { -0.0, -0.0 }, { 0.5, -1.25 }, { -2.0, 3.0 }, { 1e-3, 7.5 }, { 3.7, -0.1 }
+    };
+    const size_t count = sizeof(points) / sizeof(points[0]);
+    std::vector<double> xs(count), ys(count), batch(count);
+    for (size_t p = 0; p < count; ++p) {
+        xs[p] = points[p][0];
+        ys[p] = points[p][1];
+    }
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c) {
+        Expression expression(cases[c].text);
+        expression(count, &xs[0], &ys[0], &batch[0]);
+        for (size_t p = 0; p < count; ++p) {
+            double expected = cases[c].reference(xs[p], ys[p]);
+            double value = expression(xs[p], ys[p]);
+            std::string what = std::string("\"") + cases[c].text + "\" at (" + std::to_string(xs[p]) + ", "
+                + std::to_string(ys[p]) + ")";
+            check(close(value, expected), what + ": " + std::to_string(value) + " != " + std::to_string(expected));
+            check(identical(batch[p], value) || (std::isnan(batch[p]) && std::isnan(value)), what + ": batch");
+        }
+    }
+}
+
+void testSimplifications() {
+    // Signed zeros survive
+    check(!std::signbit(Expression("x + 0")(-0.0, 0.0)), "x + 0 at -0 is +0");
+    check(!std::signbit(Expression("0 - x")(0.0, 0.0)), "0 - x at 0 is +0");
+    check(std::signbit(Expression("x - 0")(-0.0, 0.0)), "x - 0 at -0 is -0");
+    check(std::signbit(Expression("x + -0")(-0.0, 0.0)), "x + -0 at -0 is -0");
+
+    // Rewrites that do not round differently, and powers left to pow
+    for (double x = -3.0; x <= 3.0; x += 0.37) {
+        check(identical(Expression("x^2")(x, 0.0), x * x), "x^2 is x*x");
+        check(identical(Expression("x / 8")(x, 0.0), x / 8), "x / 8");
+        check(identical(Expression("x^3")(x, 0.0), std::pow(x, 3.0)), "x^3 is pow(x, 3)");
+        check(identical(Expression("x^4")(x, 0.0), std::pow(x, 4.0)), "x^4 is pow(x, 4)");
+    }
+
+    // Folding and shared subexpressions
+    check(Expression("2 * 3 + 4").getInstructionCount() == 0, "constants folded");
+    check(Expression("sin(x) + sin(x)").getInstructionCount() == Expression("sin(x) + y").getInstructionCount(),
+          "sin(x) shared");
+    check(Expression("(x*y + 1) * (x*y + 1)").getInstructionCount() == 3, "(x*y + 1)^2 in three instructions");
+    check(Expression("x + 0*y").usesY(), "0*y is kept, it is NaN for infinite y");
+    check(!Expression("sin(x) + 1").usesY(), "usesY");
+}
+
+void testErrors() {
+    const char* cases[][2] = {
+        { "x + foo(1)", "Expression: unknown name 'foo' at position 5 in \"x + foo(1)\"" },
+        { "sin(x", "Expression: expected ')' at position 6 in \"sin(x\"" },
+        { "x +", "Expression: expected a number, variable or '(' at position 4 in \"x +\"" },
+        { "x y", "Expression: unexpected 'y' at position 3 in \"x y\"" },
+        { "x + .", "Expression: malformed number at position 5 in \"x + .\"" },
+        { "pow(x)", "Expression: expected ',' at position 6 in \"pow(x)\"" }
+    };
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c) {
+        std::string message = errorOf(cases[c][0]);
+        check(message == cases[c][1], std::string("error of \"") + cases[c][0] + "\": " + message);
+    }
+}
+
+} // namespace
+
+int main() {
+    testTable();
+    testSimplifications();
+    testErrors();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All expression checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file StiffTest.cpp
+ * @brief Checks BDF and the trapezoidal method on a stiff problem
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Forward, the problem of bench_stiff: dy/dx = -1000 (y - cos x) - sin x,
+ * y(0) = 0, on [0, 10], with exact solution cos x - exp(-1000 x). Backward,
+ * its mirror dy/dx = 1000 (y - cos x) - sin x from y(10) = cos 10 + 1 to
+ * x = 0, with exact solution cos x + exp(1000 (x - 10)), which is stiff
+ * in the direction of integration. Both methods must reach the exact
+ * solution at the end with step sizes far beyond the stability limit of
+ * explicit methods, and the trapezoidal method must show order 2.
+ * Exits with 1 if a check fails.
+ */
+
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "BDF.h"
+#include "Trapezoidal.h"
+
+namespace {
+
+const double STIFFNESS = 1000.0;
+const double END = 10.0;
+
+int failures = 0;
+
+void check(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+double forwardExact(double x) {
+    return std::cos(x) - std::exp(-STIFFNESS * x);
+}
+
+double backwardExact(double x) {
+    return std::cos(x) + std::exp(STIFFNESS * (x - END));
+}
+
+// Error at the end of a solve from x0 to xTarget with step h
+double solveError(NumericalMethod& method, bool backward, double h) {
+    method.setVerbose(false);
+    const double sign = backward ? 1.0 : -1.0;
+    method.setSystemFunction([sign](double x, const double* y, double* dydx) {
+        dydx[0] = sign * STIFFNESS * (y[0] - std::cos(x)) - std::sin(x);
+    });
+    if (backward) {
+        method.setParameters(END, std::vector<double>(1, backwardExact(END)), 0.0, -h);
+    }
+    else {
+        method.setParameters(0.0, std::vector<double>(1, forwardExact(0.0)), END, h);
+    }
+    method.solveSystem();
+
+    const double xEnd = backward ? 0.0 : END;
+    check(std::abs(method.getXValues().back() - xEnd) <= 1e-12, method.getMethodName() + ": final x");
+    double exact = backward ? backwardExact(xEnd) : forwardExact(xEnd);
+    return std::abs(method.getStateResult()[0] - exact);
+}
+
+void testTrapezoidal(bool backward) {
+    const std::string what = std::string("Trapezoidal, ") + (backward ? "backward" : "forward");
+    Trapezoidal method;
+
+    // h * 1000 = 10, four times the stability limit of RK4
+    double coarse = solveError(method, backward, 0.01);
+    double fine = solveError(method, backward, 0.005);
+    check(coarse <= 1e-7, what + ": error " + std::to_string(coarse));
+    double observed = std::log2(coarse / fine);
+    check(std::abs(observed - 2.0) <= 0.2, what + ": observed order " + std::to_string(observed));
+}
+
+void testBdf(bool backward) {
+    const std::string what = std::string("BDF, ") + (backward ? "backward" : "forward");
+    BDF method;
+    double previous = INFINITY;
+    for (int digits = 4; digits <= 8; digits += 2) {
+        const double tolerance = std::pow(10.0, -digits);
+        method.setTolerances(tolerance, tolerance);
+        double error = solveError(method, backward, 1e-3);
+        std::string at = what + ", tolerance 1e-" + std::to_string(digits);
+        check(error <= 100.0 * tolerance, at + ": error " + std::to_string(error));
+        check(error < previous, at + ": error does not decrease");
+        // An explicit method needs more than 1400 steps for stability alone
+        check(method.getXValues().size() < 1000, at + ": " + std::to_string(method.getXValues().size()) + " steps");
+        previous = error;
+    }
+}
+
+} // namespace
+
+int main() {
+    testTrapezoidal(false);
+    testTrapezoidal(true);
+    testBdf(false);
+    testBdf(true);
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All stiff checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file WorkPrecisionTool.cpp
+ * @brief Command-line work-precision diagram generator
+ * @author Prathamesh Khade
+ * @date 2025-06-07
+ *
+ * Usage: work_precision [--h0 H] [--levels N] [--target-x X] [--repeats R]
+ *                       [--error E] [--csv FILE] [--json FILE|-]
+ *
+ * Runs every method over h0, h0/2, ... on dy/dx = x + y from (0, 1),
+ * prints wall time, evaluations, error and observed order for each run,
+ * and names the cheapest run whose error is at most E.
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+
+#include "WorkPrecision.h"
+
+namespace {
+
+void printUsage() {
+    std::cerr << "Usage: work_precision [--h0 H] [--levels N] [--target-x X] [--repeats R]\n"
+              << "                      [--error E] [--csv FILE] [--json FILE|-]" << std::endl;
+}
+
+void printChoice(const char* label, const WorkPrecisionPoint* point) {
+    std::cout << label;
+    if (point == NULL) {
+        std::cout << "no run reached the error target" << std::endl;
+        return;
+    }
+    std::cout << point->method << " with h = " << point->stepSize;
+    if (point->tolerance > 0.0) {
+        std::cout << ", tolerance = " << point->tolerance;
+    }
+    std::cout << " (" << point->evaluations << " evaluations, "
+              << point->seconds * 1e3 << " ms, error " << point->error << ")" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    double h0 = 0.1;
+    int levels = 8;
+    double xTarget = 1.0;
+    int repeats = 3;
+    double targetError = 1e-4;
+    std::string csvFile;
+    std::string jsonFile;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (arg == "--h0") {
+            h0 = std::atof(value);
+        }
+        else if (arg == "--levels") {
+            levels = std::atoi(value);
+        }
+        else if (arg == "--target-x") {
+            xTarget = std::atof(value);
+        }
+        else if (arg == "--repeats") {
+            repeats = std::atoi(value);
+        }
+        else if (arg == "--error") {
+            targetError = std::atof(value);
+        }
+        else if (arg == "--csv") {
+            csvFile = value;
+        }
+        else if (arg == "--json") {
+            jsonFile = value;
+        }
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    try {
+        WorkPrecision study;
+        study.addAllMethods();
+        study.setStepSizes(h0, levels);
+        study.setTarget(xTarget);
+        study.setRepeats(repeats);
+        study.run();
+
+        // Keep stdout clean when it carries the JSON
+        if (jsonFile != "-") {
+            study.printTable();
+            std::cout << "\nError target: " << targetError << std::endl;
+            printChoice("Cheapest by time:        ", study.cheapest(targetError));
+            printChoice("Cheapest by evaluations: ", study.cheapest(targetError, true));
+        }
+
+        if (!csvFile.empty()) {
+            study.saveToCSV(csvFile);
+        }
+        if (!jsonFile.empty()) {
+            study.saveToJSON(jsonFile);
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}